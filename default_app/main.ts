@@ -120,6 +120,10 @@ async function loadApplicationPackage (packagePath: string) {
       if (packageJson.v8Flags) {
         (await import('node:v8')).setFlagsFromString(packageJson.v8Flags);
       }
+      if (packageJson.startupCodeCache === true) {
+        const v8Util = process._linkedBinding('electron_common_v8_util');
+        v8Util.getHiddenValue<(appPath: string) => void>(global, 'enableStartupCodeCache')(packagePath);
+      }
       appPath = packagePath;
     }
 
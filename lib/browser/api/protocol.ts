@@ -1,8 +1,9 @@
 import { ProtocolRequest, session } from 'electron/main';
 
 import { createReadStream } from 'fs';
+import * as path from 'path';
 import { Readable } from 'stream';
-import { ReadableStream } from 'stream/web';
+import { ReadableStream, ReadableStreamBYOBReader } from 'stream/web';
 
 // Global protocol APIs.
 const { registerSchemesAsPrivileged, getStandardSchemes, Protocol } = process._linkedBinding('electron_browser_protocol');
@@ -12,6 +13,8 @@ const ERR_UNEXPECTED = -9;
 
 const isBuiltInScheme = (scheme: string) => ['http', 'https', 'file'].includes(scheme);
 
+const DEFAULT_READ_SIZE = 256 * 1024;
+
 function makeStreamFromPipe (pipe: any): ReadableStream {
   const buf = new Uint8Array(1024 * 1024 /* 1 MB */);
   return new ReadableStream({
@@ -45,6 +48,42 @@ function makeStreamFromFileInfo ({
   }));
 }
 
+function makeReadableFromResponseBody (body: ReadableStream<ArrayBufferView>, readSize: number): Readable {
+  // Byte streams are read |readSize| bytes at a time, which spares allocating
+  // a chunk per enqueue() and lets one read return a whole buffer's worth.
+  let reader: ReadableStreamBYOBReader | undefined;
+  try {
+    reader = (body as ReadableStream<Uint8Array>).getReader({ mode: 'byob' });
+  } catch {
+    // Not a byte stream.
+  }
+  if (!reader) return Readable.fromWeb(body, { highWaterMark: readSize });
+
+  const byobReader = reader;
+  // Every read goes into the same scratch buffer, and only the bytes it
+  // returned are copied out. The read detaches the buffer it was given, so
+  // the pushed chunks must not be views of it.
+  let scratch = new ArrayBuffer(readSize);
+  return new Readable({
+    highWaterMark: readSize,
+    async read () {
+      try {
+        let result;
+        do {
+          result = await byobReader.read(new Uint8Array(scratch));
+          if (!result.done) scratch = result.value.buffer as ArrayBuffer;
+        } while (!result.done && result.value.byteLength === 0);
+        this.push(result.done ? null : Buffer.from(result.value));
+      } catch (e) {
+        this.destroy(e as Error);
+      }
+    },
+    destroy (error, callback) {
+      byobReader.cancel(error).then(() => callback(error), callback);
+    }
+  });
+}
+
 function convertToRequestBody (uploadData: ProtocolRequest['uploadData']): RequestInit['body'] {
   if (!uploadData) return null;
   // Optimization: skip creating a stream if the request is just a single buffer.
@@ -108,7 +147,13 @@ function validateResponse (res: Response) {
   return true;
 }
 
-Protocol.prototype.handle = function (this: Electron.Protocol, scheme: string, handler: (req: Request) => Response | Promise<Response>) {
+Protocol.prototype.handle = function (this: Electron.Protocol, scheme: string, handler: (req: Request) => Response | Promise<Response>, options?: Electron.HandleOptions) {
+  if (options?.cache && isBuiltInScheme(scheme)) {
+    throw new Error(`Response caching is not supported for the ${scheme} scheme`);
+  }
+  if (options?.cache?.diskPath !== undefined && !path.isAbsolute(options.cache.diskPath)) {
+    throw new TypeError('cache.diskPath must be an absolute path');
+  }
   const register = isBuiltInScheme(scheme) ? this.interceptProtocol : this.registerProtocol;
   const success = register.call(this, scheme, async (preq: ProtocolRequest, cb: any) => {
     try {
@@ -131,7 +176,7 @@ Protocol.prototype.handle = function (this: Electron.Protocol, scheme: string, h
         cb({ error: ERR_FAILED });
       } else {
         cb({
-          data: res.body ? Readable.fromWeb(res.body as ReadableStream<ArrayBufferView>) : null,
+          data: res.body ? makeReadableFromResponseBody(res.body as ReadableStream<ArrayBufferView>, options?.readSize ?? DEFAULT_READ_SIZE) : null,
           headers: res.headers ? Object.fromEntries(res.headers) : {},
           statusCode: res.status,
           statusText: res.statusText,
@@ -144,6 +189,7 @@ Protocol.prototype.handle = function (this: Electron.Protocol, scheme: string, h
     }
   });
   if (!success) throw new Error(`Failed to register protocol: ${scheme}`);
+  if (options?.cache) this._setResponseCache(scheme, options.cache);
 };
 
 Protocol.prototype.unhandle = function (this: Electron.Protocol, scheme: string) {
@@ -177,7 +223,10 @@ const protocol = {
   isProtocolIntercepted: (...args) => session.defaultSession.protocol.isProtocolIntercepted(...args),
   handle: (...args) => session.defaultSession.protocol.handle(...args),
   unhandle: (...args) => session.defaultSession.protocol.unhandle(...args),
-  isProtocolHandled: (...args) => session.defaultSession.protocol.isProtocolHandled(...args)
+  isProtocolHandled: (...args) => session.defaultSession.protocol.isProtocolHandled(...args),
+  registerDirectoryHandler: (...args) => session.defaultSession.protocol.registerDirectoryHandler(...args),
+  getResponseCacheStats: (...args) => session.defaultSession.protocol.getResponseCacheStats(...args),
+  clearResponseCache: (...args) => session.defaultSession.protocol.clearResponseCache(...args)
 } as typeof Electron.protocol;
 
 export default protocol;
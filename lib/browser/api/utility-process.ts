@@ -6,11 +6,15 @@ import { Duplex, PassThrough } from 'stream';
 
 const { _fork } = process._linkedBinding('electron_browser_utility_process');
 
+// Emitted once the process has loaded its preload modules and entry script. A
+// symbol, so that it can't clash with the events of the public API.
+const kReady = Symbol('ready');
+
 class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess {
   #handle: ElectronInternal.UtilityProcessWrapper | null;
   #stdout: Duplex | null = null;
   #stderr: Duplex | null = null;
-  constructor (modulePath: string, args?: string[], options?: Electron.ForkOptions) {
+  constructor (modulePath: string, args?: string[], options?: Electron.ForkOptions, preload: string[] = []) {
     super();
 
     if (!modulePath) {
@@ -90,7 +94,7 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
       }
     }
 
-    this.#handle = _fork({ options, modulePath, args });
+    this.#handle = _fork({ options, modulePath, args, preload });
     this.#handle!.emit = (channel: string | symbol, ...args: any[]) => {
       if (channel === 'exit') {
         try {
@@ -113,6 +117,8 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
       } else if (channel === 'stderr' && this.#stderr) {
         new Socket({ fd: args[0], readable: true }).pipe(this.#stderr);
         return true;
+      } else if (channel === 'ready') {
+        return this.emit(kReady);
       } else {
         return this.emit(channel, ...args);
       }
@@ -150,3 +156,179 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
 export function fork (modulePath: string, args?: string[], options?: Electron.ForkOptions) {
   return new ForkUtilityProcess(modulePath, args, options);
 }
+
+// Once this many workers in a row exit before they are ready, workers are
+// no longer respawned until the next acquire(), so that a worker that cannot
+// start is not launched over and over.
+const kMaxStartupFailures = 3;
+
+interface PoolWorker {
+  state: 'starting' | 'idle' | 'busy';
+  jobs: number;
+}
+
+interface PendingAcquire {
+  resolve: (worker: Electron.UtilityProcess) => void;
+  reject: (error: Error) => void;
+  queuedAt: number;
+}
+
+class UtilityProcessPool implements Electron.UtilityProcessPool {
+  #modulePath: string;
+  #args: string[];
+  #options: Electron.ForkOptions;
+  #preload: string[];
+  #size: number;
+  #maxJobsPerWorker: number;
+  #workers = new Map<Electron.UtilityProcess, PoolWorker>();
+  #queue: PendingAcquire[] = [];
+  #closed = false;
+  #startupFailures = 0;
+  #acquired = 0;
+  #completedJobs = 0;
+  #recycled = 0;
+  #crashed = 0;
+  #totalWaitTime = 0;
+
+  constructor (options: Electron.CreatePoolOptions) {
+    if (options == null || typeof options !== 'object') {
+      throw new TypeError('Options must be an object.');
+    }
+
+    const { modulePath, args, size = 1, preload, maxJobsPerWorker, ...forkOptions } = options;
+    if (!modulePath) {
+      throw new Error('Missing UtilityProcess entry script.');
+    }
+
+    if (!Number.isInteger(size) || size < 1) {
+      throw new TypeError('size must be a positive integer.');
+    }
+
+    if (maxJobsPerWorker != null && (!Number.isInteger(maxJobsPerWorker) || maxJobsPerWorker < 1)) {
+      throw new TypeError('maxJobsPerWorker must be a positive integer.');
+    }
+
+    if (preload != null && (!Array.isArray(preload) || preload.some(id => typeof id !== 'string'))) {
+      throw new TypeError('preload must be an array of strings.');
+    }
+
+    this.#modulePath = modulePath;
+    this.#args = args ?? [];
+    this.#options = forkOptions as Electron.ForkOptions;
+    this.#preload = preload ?? [];
+    this.#size = size;
+    this.#maxJobsPerWorker = maxJobsPerWorker ?? Infinity;
+
+    this.#fill();
+  }
+
+  acquire (): Promise<Electron.UtilityProcess> {
+    if (this.#closed) {
+      return Promise.reject(new Error('The utility process pool is closed.'));
+    }
+
+    return new Promise((resolve, reject) => {
+      this.#queue.push({ resolve, reject, queuedAt: Date.now() });
+      this.#startupFailures = 0;
+      this.#fill();
+      this.#dispatch();
+    });
+  }
+
+  release (worker: Electron.UtilityProcess) {
+    const entry = this.#workers.get(worker);
+    if (!entry || entry.state !== 'busy') return;
+
+    ++entry.jobs;
+    ++this.#completedJobs;
+    if (entry.jobs >= this.#maxJobsPerWorker) {
+      ++this.#recycled;
+      this.#workers.delete(worker);
+      worker.kill();
+      this.#fill();
+    } else {
+      entry.state = 'idle';
+      this.#dispatch();
+    }
+  }
+
+  getStats (): Electron.UtilityProcessPoolStats {
+    const stats = { size: this.#size, starting: 0, idle: 0, busy: 0 };
+    for (const { state } of this.#workers.values()) {
+      ++stats[state];
+    }
+    return {
+      ...stats,
+      queued: this.#queue.length,
+      completedJobs: this.#completedJobs,
+      recycled: this.#recycled,
+      crashed: this.#crashed,
+      averageWaitTime: this.#acquired ? this.#totalWaitTime / this.#acquired : 0
+    };
+  }
+
+  close () {
+    if (this.#closed) return;
+    this.#closed = true;
+    this.#rejectQueue(new Error('The utility process pool is closed.'));
+    const workers = [...this.#workers.keys()];
+    this.#workers.clear();
+    for (const worker of workers) {
+      worker.kill();
+    }
+  }
+
+  #fill () {
+    if (this.#closed || this.#startupFailures >= kMaxStartupFailures) return;
+    while (this.#workers.size < this.#size) {
+      const worker = new ForkUtilityProcess(this.#modulePath, this.#args, this.#options, this.#preload);
+      const entry: PoolWorker = { state: 'starting', jobs: 0 };
+      this.#workers.set(worker, entry);
+      worker.once(kReady, () => {
+        if (entry.state !== 'starting') return;
+        entry.state = 'idle';
+        this.#startupFailures = 0;
+        this.#dispatch();
+      });
+      worker.once('exit', () => this.#onExit(worker, entry));
+    }
+  }
+
+  #dispatch () {
+    while (this.#queue.length > 0) {
+      const worker = [...this.#workers].find(([, entry]) => entry.state === 'idle')?.[0];
+      if (!worker) return;
+
+      const { resolve, queuedAt } = this.#queue.shift()!;
+      this.#workers.get(worker)!.state = 'busy';
+      ++this.#acquired;
+      this.#totalWaitTime += Date.now() - queuedAt;
+      resolve(worker);
+    }
+  }
+
+  #onExit (worker: Electron.UtilityProcess, entry: PoolWorker) {
+    // Workers retired by the pool are no longer tracked.
+    if (this.#workers.get(worker) !== entry) return;
+
+    this.#workers.delete(worker);
+    ++this.#crashed;
+    if (entry.state === 'starting' && ++this.#startupFailures >= kMaxStartupFailures) {
+      this.#rejectQueue(new Error('Utility process pool workers exited before they were ready.'));
+      return;
+    }
+    this.#fill();
+  }
+
+  #rejectQueue (error: Error) {
+    const queue = this.#queue;
+    this.#queue = [];
+    for (const { reject } of queue) {
+      reject(error);
+    }
+  }
+}
+
+export function createPool (options: Electron.CreatePoolOptions) {
+  return new UtilityProcessPool(options);
+}
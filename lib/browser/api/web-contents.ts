@@ -212,8 +212,7 @@ function parsePageSize (pageSize: string | ElectronInternal.PageSize) {
 
 // Translate the options of printToPDF.
 
-let pendingPromise: Promise<any> | undefined;
-WebContents.prototype.printToPDF = async function (options) {
+function getPrintToPDFSettings (options: Electron.PrintToPDFOptions) {
   const margins = checkType(options.margins ?? {}, 'object', 'margins');
   const pageSize = parsePageSize(options.pageSize ?? 'letter');
 
@@ -225,7 +224,7 @@ WebContents.prototype.printToPDF = async function (options) {
     throw new Error('margins must be less than or equal to pageSize');
   }
 
-  const printSettings = {
+  return {
     requestID: getNextId(),
     landscape: checkType(options.landscape ?? false, 'boolean', 'landscape'),
     displayHeaderFooter: checkType(options.displayHeaderFooter ?? false, 'boolean', 'displayHeaderFooter'),
@@ -243,17 +242,32 @@ WebContents.prototype.printToPDF = async function (options) {
     generateDocumentOutline: checkType(options.generateDocumentOutline ?? false, 'boolean', 'generateDocumentOutline'),
     ...pageSize
   };
+}
 
-  if (this._printToPDF) {
+let pendingPromise: Promise<any> | undefined;
+function queuePrintToPDF (webContents: Electron.WebContents, printSettings: any) {
+  if (webContents._printToPDF) {
     if (pendingPromise) {
-      pendingPromise = pendingPromise.then(() => this._printToPDF(printSettings));
+      pendingPromise = pendingPromise.then(() => webContents._printToPDF(printSettings));
     } else {
-      pendingPromise = this._printToPDF(printSettings);
+      pendingPromise = webContents._printToPDF(printSettings);
     }
     return pendingPromise;
   } else {
     throw new Error('Printing feature is disabled');
   }
+}
+
+WebContents.prototype.printToPDF = async function (options) {
+  return queuePrintToPDF(this, getPrintToPDFSettings(options));
+};
+
+WebContents.prototype.printToPDFFile = async function (filePath, options = {}) {
+  const pdfPath = checkType(filePath, 'string', 'filePath');
+  if (!path.isAbsolute(pdfPath)) {
+    throw new Error('filePath must be an absolute path');
+  }
+  return queuePrintToPDF(this, { ...getPrintToPDFSettings(options), path: pdfPath });
 };
 
 // TODO(codebytere): deduplicate argument sanitization by moving rest of
@@ -908,3 +922,26 @@ export function getFocusedWebContents () {
 export function getAllWebContents () {
   return binding.getAllWebContents();
 }
+
+export async function capturePages (targets: Electron.WebContents[], options: Electron.CapturePagesOptions = {}) {
+  const { rect, concurrency = 4, ...captureOptions } = options;
+  if (!Number.isInteger(concurrency) || concurrency < 1) {
+    throw new RangeError('concurrency must be a positive integer');
+  }
+
+  // Bound the number of outstanding captures so that viz isn't asked to copy
+  // every surface at once.
+  const results: Array<Electron.NativeImage | Buffer | Electron.CapturedBitmap> = new Array(targets.length);
+  let next = 0;
+  const worker = async () => {
+    while (next < targets.length) {
+      const index = next++;
+      const target = targets[index];
+      results[index] = await (captureOptions.format
+        ? target.capturePageToBuffer(rect, captureOptions)
+        : target.capturePage(rect, captureOptions));
+    }
+  };
+  await Promise.all(Array.from({ length: Math.min(concurrency, targets.length) }, worker));
+  return results;
+}
@@ -1,4 +1,6 @@
 import type * as defaultMenuModule from '@electron/internal/browser/default-menu';
+import type * as startupCodeCacheModule from '@electron/internal/browser/startup-code-cache';
+import type * as startupSnapshotModule from '@electron/internal/browser/startup-snapshot';
 
 import { EventEmitter } from 'events';
 import * as fs from 'fs';
@@ -140,6 +142,19 @@ if (packageJson.v8Flags != null) {
 
 app.setAppPath(packagePath);
 
+// Enable the startup code cache, deliberately lazy load so that apps that do
+// not use this feature do not pay the price
+const enableStartupCodeCache = (appPath: string) => {
+  const { enableStartupCodeCache } = require('@electron/internal/browser/startup-code-cache') as typeof startupCodeCacheModule;
+  enableStartupCodeCache(getOrCreateArchive?.(appPath) ?? null);
+};
+if (packageJson.startupCodeCache === true) {
+  enableStartupCodeCache(packagePath);
+} else {
+  // The default app reads the package.json of the app it runs by itself.
+  v8Util.setHiddenValue(global, 'enableStartupCodeCache', enableStartupCodeCache);
+}
+
 // Load the chrome devtools support.
 require('@electron/internal/browser/devtools');
 
@@ -201,7 +216,18 @@ app.once('will-finish-launching', setDefaultApplicationMenu);
 const { appCodeLoaded } = process;
 delete process.appCodeLoaded;
 
-if (packagePath) {
+// Deserialize the app state baked into a V8 startup snapshot, if any,
+// deliberately lazy load so that apps that do not use this feature do not pay
+// the price. The key is set by the prelude of script/build-startup-snapshot.js.
+let ranSnapshotMain = false;
+if (packagePath && Symbol.for('electron.startupSnapshot') in globalThis) {
+  const { deserializeStartupSnapshot } = require('@electron/internal/browser/startup-snapshot') as typeof startupSnapshotModule;
+  ranSnapshotMain = deserializeStartupSnapshot(path.join(packagePath, mainStartupScript), appCodeLoaded!);
+}
+
+if (ranSnapshotMain) {
+  // The main function of the snapshot runs instead of the app's main script.
+} else if (packagePath) {
   // Finally load app's main.js and transfer control to C++.
   if ((packageJson.type === 'module' && !mainStartupScript.endsWith('.cjs')) || mainStartupScript.endsWith('.mjs')) {
     const { runEntryPointWithESMLoader } = __non_webpack_require__('internal/modules/run_main');
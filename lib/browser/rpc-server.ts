@@ -4,6 +4,7 @@ import { IPC_MESSAGES } from '@electron/internal/common/ipc-messages';
 
 import { clipboard } from 'electron/common';
 
+import * as crypto from 'crypto';
 import * as fs from 'fs';
 import * as path from 'path';
 
@@ -68,11 +69,61 @@ const getPreloadScriptsFromEvent = (event: ElectronInternal.IpcMainInternalEvent
   return preloadScripts.filter(script => path.isAbsolute(script.filePath));
 };
 
-const readPreloadScript = async function (script: Electron.PreloadScript): Promise<ElectronInternal.PreloadScript> {
+interface CachedPreloadScript {
+  mtimeMs: number;
+  size: number;
+  contents: string;
+  // Hash of |contents|, which renderers send back with the code caches they
+  // produce from it.
+  contentHash: string;
+  // V8 code caches produced by renderers, keyed by the origin of the frame
+  // that produced them so that a renderer can only affect its own origin.
+  // Ordered from the least to the most recently used.
+  codeCaches: Map<string, Uint8Array>;
+}
+
+// Code caches are kept for this many origins per preload script.
+const kMaxCodeCachesPerScript = 16;
+
+// Sources of preload scripts for sandboxed renderers, until they change on
+// disk.
+const preloadScriptCache = new Map<string, CachedPreloadScript>();
+
+const readCachedPreloadScript = async function (filePath: string) {
+  const { mtimeMs, size } = await fs.promises.stat(filePath);
+  let cached = preloadScriptCache.get(filePath);
+  if (!cached || cached.mtimeMs !== mtimeMs || cached.size !== size) {
+    const contents = await fs.promises.readFile(filePath, 'utf8');
+    const contentHash = crypto.createHash('sha256').update(contents).digest('hex');
+    cached = { mtimeMs, size, contents, contentHash, codeCaches: new Map() };
+    preloadScriptCache.set(filePath, cached);
+  }
+  return cached;
+};
+
+// Frames with an opaque origin all report "null", so they get no cache.
+const getCodeCacheKey = function (event: ElectronInternal.IpcMainInternalEvent) {
+  if (event.type !== 'frame' || !event.senderFrame) return;
+  const { origin } = event.senderFrame;
+  return origin !== 'null' ? origin : undefined;
+};
+
+const readPreloadScript = async function (script: Electron.PreloadScript, codeCacheKey?: string): Promise<ElectronInternal.PreloadScript> {
   let contents;
+  let codeCache;
+  let codeCacheVersion;
   let error;
   try {
-    contents = await fs.promises.readFile(script.filePath, 'utf8');
+    const cached = await readCachedPreloadScript(script.filePath);
+    contents = cached.contents;
+    if (codeCacheKey) {
+      codeCacheVersion = cached.contentHash;
+      codeCache = cached.codeCaches.get(codeCacheKey);
+      if (codeCache) {
+        cached.codeCaches.delete(codeCacheKey);
+        cached.codeCaches.set(codeCacheKey, codeCache);
+      }
+    }
   } catch (err) {
     if (err instanceof Error) {
       error = err;
@@ -81,14 +132,17 @@ const readPreloadScript = async function (script: Electron.PreloadScript): Promi
   return {
     ...script,
     contents,
+    codeCache,
+    codeCacheVersion,
     error
   };
 };
 
 ipcMainUtils.handleSync(IPC_MESSAGES.BROWSER_SANDBOX_LOAD, async function (event) {
   const preloadScripts = getPreloadScriptsFromEvent(event);
+  const codeCacheKey = getCodeCacheKey(event);
   return {
-    preloadScripts: await Promise.all(preloadScripts.map(readPreloadScript)),
+    preloadScripts: await Promise.all(preloadScripts.map(script => readPreloadScript(script, codeCacheKey))),
     process: {
       arch: process.arch,
       platform: process.platform,
@@ -105,6 +159,23 @@ ipcMainUtils.handleSync(IPC_MESSAGES.BROWSER_NONSANDBOX_LOAD, function (event) {
   return { preloadPaths: preloadScripts.map(script => script.filePath) };
 });
 
+// The cache was produced from the source a frame was given, which may have
+// changed on disk since. V8 only checks the length of the source it is used
+// with, so caches of other sources are dropped here.
+ipcMainInternal.on(IPC_MESSAGES.BROWSER_PRELOAD_CODE_CACHE, function (event, filePath: string, codeCacheVersion: string, codeCache: Uint8Array) {
+  const codeCacheKey = getCodeCacheKey(event);
+  const cached = preloadScriptCache.get(filePath);
+  if (!codeCacheKey || !cached || cached.contentHash !== codeCacheVersion || !(codeCache instanceof Uint8Array)) {
+    return;
+  }
+
+  cached.codeCaches.delete(codeCacheKey);
+  cached.codeCaches.set(codeCacheKey, codeCache);
+  if (cached.codeCaches.size > kMaxCodeCachesPerScript) {
+    cached.codeCaches.delete(cached.codeCaches.keys().next().value!);
+  }
+});
+
 ipcMainInternal.on(IPC_MESSAGES.BROWSER_PRELOAD_ERROR, function (event, preloadPath: string, error: Error) {
   if (event.type !== 'frame') return;
   event.sender?.emit('preload-error', event, preloadPath, error);
@@ -0,0 +1,45 @@
+import { app } from 'electron/main';
+
+import * as fs from 'fs';
+import * as path from 'path';
+
+const Module = require('module') as NodeJS.ModuleInternal;
+
+const kCacheDirName = 'Startup Code Cache';
+
+// The cache is only valid for one build of the app, so each build gets its own
+// directory, named after the app's version and the header of its asar archive.
+function getCacheKey (archive: NodeJS.AsarArchive | null) {
+  const headerHash = archive?.getHeaderHash();
+  const key = headerHash ? `${app.getVersion()}-${headerHash.slice(0, 16)}` : app.getVersion();
+  return key.replace(/[^\w.-]/g, '_');
+}
+
+function removeStaleCaches (cacheRoot: string, key: string) {
+  fs.promises.readdir(cacheRoot).then(entries => Promise.all(
+    entries.filter(entry => entry !== key)
+      .map(entry => fs.promises.rm(path.join(cacheRoot, entry), { recursive: true, force: true }))
+  )).catch(() => {});
+}
+
+// Compiles the modules of the main process against a code cache stored under
+// userData. The first launch of a build records the modules compiled until the
+// app is ready, later launches deserialize them instead of compiling them.
+export function enableStartupCodeCache (archive: NodeJS.AsarArchive | null) {
+  const key = getCacheKey(archive);
+  // The cache has to be opened before the app's code runs, so it does not
+  // follow a userData path or a name set by the app.
+  const cacheRoot = path.join(app.getPath('userData'), kCacheDirName);
+  const { directory } = Module.enableCompileCache(path.join(cacheRoot, key));
+  if (!directory) return;
+
+  // Write the cache once the startup path has run, instead of waiting for the
+  // process to exit, which may never happen cleanly.
+  app.whenReady().then(() => {
+    setImmediate(() => {
+      Module.flushCompileCache();
+      removeStaleCaches(cacheRoot, key);
+    });
+  });
+  app.once('will-quit', () => Module.flushCompileCache());
+}
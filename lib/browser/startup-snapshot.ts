@@ -0,0 +1,33 @@
+const Module = require('module') as NodeJS.ModuleInternal;
+
+type Callback = [(data: unknown) => void, unknown];
+
+// Mirrors the state kept by the prelude of script/build-startup-snapshot.js.
+interface StartupSnapshotState {
+  deserializeCallbacks: Callback[];
+  mainFunction: Callback | null;
+  require: NodeJS.Require | null;
+}
+
+const kStateKey = Symbol.for('electron.startupSnapshot');
+
+// Deserializes the app state baked into the startup snapshot. Requires from
+// the snapshot are resolved from |mainPath| from now on. Returns whether the
+// snapshot set a main function, which then runs instead of |mainPath|.
+export function deserializeStartupSnapshot (mainPath: string, appCodeLoaded: () => void) {
+  const state = (globalThis as any)[kStateKey] as StartupSnapshotState;
+  delete (globalThis as any)[kStateKey];
+
+  state.require = Module.createRequire(mainPath);
+  for (const [callback, data] of state.deserializeCallbacks) {
+    callback(data);
+  }
+  state.deserializeCallbacks = [];
+
+  if (!state.mainFunction) return false;
+
+  const [main, data] = state.mainFunction;
+  appCodeLoaded();
+  main(data);
+  return true;
+}
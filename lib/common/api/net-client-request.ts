@@ -3,6 +3,7 @@ import type {
   UploadProgress
 } from 'electron/common';
 
+import * as path from 'path';
 import { Readable, Writable } from 'stream';
 import * as url from 'url';
 
@@ -294,6 +295,19 @@ function parseOptions (optionsIn: ClientRequestConstructorOptions | string): Nod
   if ('priorityIncremental' in options) {
     urlLoaderOptions.priorityIncremental = options.priorityIncremental;
   }
+  if (options.saveToFile != null) {
+    const { path: filePath, hash, resumeFrom } = options.saveToFile;
+    if (typeof filePath !== 'string' || !path.isAbsolute(filePath)) {
+      throw new TypeError('saveToFile.path must be an absolute path');
+    }
+    if (hash != null && hash !== 'sha256') {
+      throw new TypeError(`Unsupported saveToFile.hash: ${hash}`);
+    }
+    if (resumeFrom != null && (!Number.isSafeInteger(resumeFrom) || resumeFrom < 0)) {
+      throw new TypeError('saveToFile.resumeFrom must be a non-negative integer');
+    }
+    urlLoaderOptions.saveToFile = { path: filePath, hash, resumeFrom };
+  }
   const headers: Record<string, string | string[]> = options.headers || {};
   for (const [name, value] of Object.entries(headers)) {
     validateHeader(name, value);
@@ -447,6 +461,9 @@ export class ClientRequest extends Writable implements Electron.ClientRequest {
     this._urlLoader.on('data', (event, data, resume) => {
       this._response!._storeInternalData(Buffer.from(data), resume);
     });
+    this._urlLoader.on('saved', (event, details) => {
+      this.emit('saved', details);
+    });
     this._urlLoader.on('complete', () => {
       if (this._response) { this._response._storeInternalData(null, null); }
     });
@@ -8,7 +8,7 @@ import * as events from 'events';
 declare const binding: {
   get: (name: string) => any;
   process: NodeJS.Process;
-  createPreloadScript: (src: string) => Function
+  createPreloadScript: (src: string, codeCache?: Uint8Array, produceCodeCache?: boolean) => ElectronInternal.CompiledPreloadScript
 };
 
 const ipcRendererUtils = require('@electron/internal/renderer/ipc-renderer-internal-utils') as typeof ipcRendererUtilsModule;
@@ -130,6 +130,27 @@ if (nodeIntegration) {
   }
 }
 
+// Same-origin sub frames may share this environment instead of creating their
+// own, ElectronRendererClient will look for this object to set them up.
+if (hasSwitch('node-integration-shared-environment')) {
+  const { EventEmitter } = require('events');
+  const timers = require('timers');
+  const v8Util = process._linkedBinding('electron_common_v8_util');
+  v8Util.setHiddenValue<ElectronInternal.SharedEnvironment>(globalThis, 'shared-environment', {
+    createRequire: Module.createRequire,
+    // Each frame gets its own events on top of the shared process object.
+    createProcess () {
+      const frameProcess = Object.create(process);
+      EventEmitter.init.call(frameProcess);
+      return frameProcess;
+    },
+    require: nodeIntegration ? global.require : undefined,
+    Buffer,
+    setImmediate: timers.setImmediate,
+    clearImmediate: timers.clearImmediate
+  });
+}
+
 const { appCodeLoaded } = process;
 delete process.appCodeLoaded;
 
@@ -8,7 +8,9 @@ import { setImmediate, clearImmediate } from 'timers';
 
 declare const binding: {
   process: NodeJS.Process;
-  createPreloadScript: (src: string) => Function
+  createPreloadScript: (src: string, codeCache?: Uint8Array, produceCodeCache?: boolean) => ElectronInternal.CompiledPreloadScript
+  // Set for frames sharing the Node.js environment of an ancestor frame.
+  node?: ElectronInternal.SharedEnvironment;
 };
 
 const ipcRendererUtils = require('@electron/internal/renderer/ipc-renderer-internal-utils') as typeof ipcRendererUtilsModule;
@@ -38,7 +40,8 @@ const loadableModules = new Map<string, Function>([
   ['node:url', () => require('url')]
 ]);
 
-const preloadProcess = createPreloadProcessObject();
+const { node } = binding;
+const preloadProcess = node ? node.createProcess() : createPreloadProcessObject();
 
 // InvokeEmitProcessEvent in ElectronSandboxedRendererClient will look for this
 const v8Util = process._linkedBinding('electron_common_v8_util');
@@ -48,24 +51,34 @@ v8Util.setHiddenValue(global, 'emit-process-event', (event: string) => {
 });
 
 Object.assign(preloadProcess, binding.process);
-Object.assign(preloadProcess, processProps);
+if (!node) {
+  Object.assign(preloadProcess, processProps);
+}
 
 Object.assign(process, processProps);
 
 // Common renderer initialization
 require('@electron/internal/renderer/common-init');
 
+// Frames sharing a Node.js environment get its globals, and with
+// nodeIntegration also its require function.
+const nodeGlobals = node
+  ? { Buffer: node.Buffer, setImmediate: node.setImmediate, clearImmediate: node.clearImmediate }
+  : { Buffer, setImmediate, clearImmediate };
+if (node?.require) {
+  Object.assign(globalThis, nodeGlobals, { require: node.require, process: preloadProcess });
+}
+
 executeSandboxedPreloadScripts({
   loadedModules,
   loadableModules,
   process: preloadProcess,
   createPreloadScript: binding.createPreloadScript,
+  createRequire: node?.createRequire,
   exposeGlobals: {
-    Buffer,
+    ...nodeGlobals,
     // FIXME(samuelmaddock): workaround webpack bug replacing this with just
     // `__webpack_require__.g,` which causes script error
-    global: globalThis,
-    setImmediate,
-    clearImmediate
+    global: globalThis
   }
 }, preloadScripts);
@@ -10,7 +10,10 @@ interface PreloadContext {
   /** Process object to pass into preloads. */
   process: NodeJS.Process;
 
-  createPreloadScript: (src: string) => Function
+  createPreloadScript: (src: string, codeCache?: Uint8Array, produceCodeCache?: boolean) => ElectronInternal.CompiledPreloadScript
+
+  /** Creates the require function of Node.js for modules that are not above. */
+  createRequire?: (filename: string) => NodeJS.Require;
 
   /** Globals to be exposed to preload context. */
   exposeGlobals: any;
@@ -44,7 +47,7 @@ export function createPreloadProcessObject (): NodeJS.Process {
 }
 
 // This is the `require` function that will be visible to the preload script
-function preloadRequire (context: PreloadContext, module: string) {
+function preloadRequire (context: PreloadContext, nodeRequire: NodeJS.Require | undefined, module: string) {
   if (context.loadedModules.has(module)) {
     return context.loadedModules.get(module);
   }
@@ -53,6 +56,9 @@ function preloadRequire (context: PreloadContext, module: string) {
     context.loadedModules.set(module, loadedModule);
     return loadedModule;
   }
+  if (nodeRequire) {
+    return nodeRequire(module);
+  }
   throw new Error(`module not found: ${module}`);
 }
 
@@ -63,7 +69,7 @@ function preloadRequire (context: PreloadContext, module: string) {
 // - `process`: The `preloadProcess` object
 // - `Buffer`: Shim of `Buffer` implementation
 // - `global`: The window object, which is aliased to `global` by webpack.
-function runPreloadScript (context: PreloadContext, preloadSrc: string) {
+function runPreloadScript (context: PreloadContext, preloadSrc: string, filePath: string, codeCache?: Uint8Array, codeCacheVersion?: string) {
   const globalVariables = [];
   const fnParameters = [];
   for (const [key, value] of Object.entries(context.exposeGlobals)) {
@@ -75,20 +81,25 @@ function runPreloadScript (context: PreloadContext, preloadSrc: string) {
   })`;
 
   // eval in window scope
-  const preloadFn = context.createPreloadScript(preloadWrapperSrc);
+  const { preload: preloadFn, codeCache: newCodeCache } =
+    context.createPreloadScript(preloadWrapperSrc, codeCache, codeCacheVersion !== undefined);
+  if (newCodeCache) {
+    ipcRendererInternal.send(IPC_MESSAGES.BROWSER_PRELOAD_CODE_CACHE, filePath, codeCacheVersion, newCodeCache);
+  }
   const exports = {};
 
-  preloadFn(preloadRequire.bind(null, context), context.process, exports, { exports }, ...fnParameters);
+  const nodeRequire = context.createRequire?.(filePath);
+  preloadFn(preloadRequire.bind(null, context, nodeRequire), context.process, exports, { exports }, ...fnParameters);
 }
 
 /**
  * Execute preload scripts within a sandboxed process.
  */
 export function executeSandboxedPreloadScripts (context: PreloadContext, preloadScripts: ElectronInternal.PreloadScript[]) {
-  for (const { filePath, contents, error } of preloadScripts) {
+  for (const { filePath, contents, codeCache, codeCacheVersion, error } of preloadScripts) {
     try {
       if (contents) {
-        runPreloadScript(context, contents);
+        runPreloadScript(context, contents, filePath, codeCache, codeCacheVersion);
       } else if (error) {
         throw error;
       }
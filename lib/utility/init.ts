@@ -35,6 +35,17 @@ parentPort.on('removeListener', (name: string) => {
   }
 });
 
+// Modules listed by a utilityProcess pool are required ahead of the entry
+// script, so that workers are warm by the time they are handed out.
+const preload: string[] = v8Util.getHiddenValue(process, '_serviceStartupPreload');
+if (preload.length > 0) {
+  const Module = require('module') as NodeJS.ModuleInternal;
+  const preloadRequire = Module.createRequire(entryScript);
+  for (const id of preload) {
+    preloadRequire(id);
+  }
+}
+
 // Finally load entry script.
 const { runEntryPointWithESMLoader } = __non_webpack_require__('internal/modules/run_main');
 const mainEntry = pathToFileURL(entryScript);
@@ -42,6 +53,8 @@ const mainEntry = pathToFileURL(entryScript);
 runEntryPointWithESMLoader(async (cascadedLoader: any) => {
   try {
     await cascadedLoader.import(mainEntry.toString(), undefined, Object.create(null));
+    // Lets a pool hand the worker out now that its modules are loaded.
+    process._linkedBinding('electron_utility_parent_port').notifyReady();
   } catch (err) {
     // @ts-ignore internalBinding is a secret internal global that we shouldn't
     // really be using, so we ignore the type error instead of declaring it in types
@@ -0,0 +1,98 @@
+// Builds a V8 startup snapshot of an app's main process state.
+//
+// The entry script is run by mksnapshot in a bare V8 context: no Node.js or
+// Electron APIs are available, only require('node:v8').startupSnapshot. The
+// resulting heap is written to browser_v8_context_snapshot.bin, which is
+// loaded by the main process when the loadBrowserProcessSpecificV8Snapshot
+// fuse is enabled.
+//
+// Usage: build-startup-snapshot.js [--mksnapshot-dir <dir>] [--output <file>]
+//                                  <entry>
+
+const childProcess = require('node:child_process');
+const fs = require('node:fs');
+const os = require('node:os');
+const path = require('node:path');
+const { parseArgs } = require('node:util');
+
+// Defines the startupSnapshot API for the entry script and keeps what it
+// registers in the snapshot, for lib/browser/startup-snapshot.ts to pick up.
+const prelude = `(function () {
+  'use strict';
+  const state = {
+    deserializeCallbacks: [],
+    mainFunction: null,
+    require: null
+  };
+  const serializeCallbacks = [];
+  const startupSnapshot = {
+    isBuildingSnapshot () {
+      return state.require === null;
+    },
+    addSerializeCallback (callback, data) {
+      serializeCallbacks.push([callback, data]);
+    },
+    addDeserializeCallback (callback, data) {
+      state.deserializeCallbacks.push([callback, data]);
+    },
+    setDeserializeMainFunction (callback, data) {
+      if (state.mainFunction) {
+        throw new Error('Deserialize main function is already configured.');
+      }
+      state.mainFunction = [callback, data];
+    }
+  };
+  const require = (id) => {
+    if (state.require) return state.require(id);
+    if (id === 'v8' || id === 'node:v8') return { startupSnapshot };
+    throw new Error(\`Cannot require '\${id}' while building the startup snapshot\`);
+  };
+  const module = { exports: {} };
+  (function (exports, require, module) {
+`;
+
+const epilogue = `
+  })(module.exports, require, module);
+  for (const [callback, data] of serializeCallbacks) callback(data);
+  Object.defineProperty(globalThis, Symbol.for('electron.startupSnapshot'), {
+    value: state,
+    configurable: true
+  });
+})();
+`;
+
+const { values, positionals } = parseArgs({
+  allowPositionals: true,
+  options: {
+    'mksnapshot-dir': { type: 'string', default: __dirname },
+    output: { type: 'string', default: 'browser_v8_context_snapshot.bin' }
+  }
+});
+
+if (positionals.length !== 1) {
+  console.error('Usage: build-startup-snapshot.js [--mksnapshot-dir <dir>] [--output <file>] <entry>');
+  process.exit(1);
+}
+
+const mksnapshotDir = path.resolve(values['mksnapshot-dir']);
+const output = path.resolve(values.output);
+const binarySuffix = process.platform === 'win32' ? '.exe' : '';
+
+const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-startup-snapshot-'));
+try {
+  const source = path.join(tmpDir, 'startup-snapshot.js');
+  fs.writeFileSync(source, prelude + fs.readFileSync(positionals[0], 'utf8') + epilogue);
+
+  // mksnapshot writes snapshot_blob.bin next to itself, which is where the
+  // context snapshot generator reads it from.
+  const mksnapshotArgs = fs.readFileSync(path.join(mksnapshotDir, 'mksnapshot_args'), 'utf8')
+    .split(/\r?\n/).filter(Boolean);
+  const [mksnapshot, ...args] = mksnapshotArgs;
+  childProcess.execFileSync(mksnapshot, [...args, source], { cwd: mksnapshotDir, stdio: 'inherit' });
+
+  const generator = path.join(mksnapshotDir, `v8_context_snapshot_generator${binarySuffix}`);
+  childProcess.execFileSync(generator, [`--output_file=${output}`], { cwd: mksnapshotDir, stdio: 'inherit' });
+  console.log(`Wrote ${output}`);
+} finally {
+  fs.rmSync(tmpDir, { recursive: true, force: true });
+}
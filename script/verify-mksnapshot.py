@@ -14,6 +14,8 @@ PROJECT_NAME = get_electron_branding()['project_name']
 PRODUCT_NAME = get_electron_branding()['product_name']
 SOURCE_ROOT = os.path.abspath(os.path.dirname(os.path.dirname(__file__)))
 SNAPSHOT_SOURCE = os.path.join(SOURCE_ROOT, 'spec', 'fixtures', 'testsnap.js')
+STARTUP_SNAPSHOT_BUILDER = os.path.join(SOURCE_ROOT, 'script',
+                                        'build-startup-snapshot.js')
 
 def main():
   args = parse_args()
@@ -25,13 +27,15 @@ def main():
   returncode = 0
   try:
     with scoped_cwd(app_path):
+      if sys.platform == 'darwin':
+        app_dir = os.path.join(app_path, f'{PRODUCT_NAME}.app')
+        electron = os.path.join(app_dir, 'Contents', 'MacOS', PRODUCT_NAME)
+      elif sys.platform == 'win32':
+        electron = os.path.join(app_path, f'{PROJECT_NAME}.exe')
+      else:
+        electron = os.path.join(app_path, PROJECT_NAME)
+
       if args.snapshot_files_dir is None:
-        snapshot_filename = os.path.join(app_path, 'mksnapshot_args')
-        with open(snapshot_filename, encoding='utf-8') as file_in:
-          mkargs = file_in.read().splitlines()
-        print('running: ' + ' '.join(mkargs + [ SNAPSHOT_SOURCE ]))
-        subprocess.check_call(mkargs + [ SNAPSHOT_SOURCE ], cwd=app_path)
-        print('ok mksnapshot successfully created snapshot_blob.bin.')
         context_snapshot = 'v8_context_snapshot.bin'
         if platform.system() == 'Darwin':
           if os.environ.get('TARGET_ARCH') == 'arm64':
@@ -39,14 +43,37 @@ def main():
           else:
             context_snapshot = 'v8_context_snapshot.x86_64.bin'
         context_snapshot_path = os.path.join(app_path, context_snapshot)
-        gen_binary = get_binary_path('v8_context_snapshot_generator', \
-                                    app_path)
-        genargs = [ gen_binary, \
-                  f'--output_file={context_snapshot_path}' ]
-        print('running: ' + ' '.join(genargs))
-        subprocess.check_call(genargs)
-        print('ok v8_context_snapshot_generator successfully created ' \
-              + context_snapshot)
+        if args.startup_snapshot:
+          # The main process loads the regular context snapshot unless the
+          # loadBrowserProcessSpecificV8Snapshot fuse is flipped, so build
+          # the startup snapshot under that name.
+          builder_source = os.path.join(SOURCE_ROOT, 'spec', 'fixtures',
+                                        'startup-snapshot', 'snapshot.js')
+          builder_args = [electron, STARTUP_SNAPSHOT_BUILDER,
+                          f'--mksnapshot-dir={app_path}',
+                          f'--output={context_snapshot_path}',
+                          builder_source]
+          env = os.environ.copy()
+          env['ELECTRON_RUN_AS_NODE'] = '1'
+          print('running: ' + ' '.join(builder_args))
+          subprocess.check_call(builder_args, env=env)
+          print('ok build-startup-snapshot.js successfully created ' \
+                + context_snapshot)
+        else:
+          snapshot_filename = os.path.join(app_path, 'mksnapshot_args')
+          with open(snapshot_filename, encoding='utf-8') as file_in:
+            mkargs = file_in.read().splitlines()
+          print('running: ' + ' '.join(mkargs + [ SNAPSHOT_SOURCE ]))
+          subprocess.check_call(mkargs + [ SNAPSHOT_SOURCE ], cwd=app_path)
+          print('ok mksnapshot successfully created snapshot_blob.bin.')
+          gen_binary = get_binary_path('v8_context_snapshot_generator', \
+                                      app_path)
+          genargs = [ gen_binary, \
+                    f'--output_file={context_snapshot_path}' ]
+          print('running: ' + ' '.join(genargs))
+          subprocess.check_call(genargs)
+          print('ok v8_context_snapshot_generator successfully created ' \
+                + context_snapshot)
         if args.create_snapshot_only:
           return 0
       else:
@@ -55,22 +82,17 @@ def main():
         for bin_file in generated_bin_files:
           shutil.copy2(bin_file, app_path)
 
-      test_path = os.path.join(SOURCE_ROOT, 'spec', 'fixtures', \
-                               'snapshot-items-available')
+      test_fixture = 'startup-snapshot' if args.startup_snapshot \
+                     else 'snapshot-items-available'
+      test_path = os.path.join(SOURCE_ROOT, 'spec', 'fixtures', test_fixture)
 
       if sys.platform == 'darwin':
         bin_files = glob.glob(os.path.join(app_path, '*.bin'))
-        app_dir = os.path.join(app_path, f'{PRODUCT_NAME}.app')
-        electron = os.path.join(app_dir, 'Contents', 'MacOS', PRODUCT_NAME)
         bin_out_path = os.path.join(app_dir, 'Contents', 'Frameworks',
                   f'{PROJECT_NAME} Framework.framework',
                   'Resources')
         for bin_file in bin_files:
           shutil.copy2(bin_file, bin_out_path)
-      elif sys.platform == 'win32':
-        electron = os.path.join(app_path, f'{PROJECT_NAME}.exe')
-      else:
-        electron = os.path.join(app_path, PROJECT_NAME)
 
       print('running: ' + ' '.join([electron, test_path]))
       subprocess.check_call([electron, test_path])
@@ -119,6 +141,10 @@ def parse_args():
                           for testing',
                       default=None,
                       required=False)
+  parser.add_argument('--startup-snapshot',
+                      help='Build the snapshot with build-startup-snapshot.js \
+                          and test the app state baked into it',
+                      action='store_true')
   parser.add_argument('--source-root',
                       default=SOURCE_ROOT,
                       required=False)
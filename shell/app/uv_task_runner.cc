@@ -4,36 +4,68 @@
 
 #include "shell/app/uv_task_runner.h"
 
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <tuple>
 #include <utility>
 
 #include "base/location.h"
-#include "base/time/time.h"
 
 namespace electron {
 
-UvTaskRunner::UvTaskRunner(uv_loop_t* loop) : loop_{loop} {}
+UvTaskRunner::DelayedTask::DelayedTask(base::TimeTicks run_time,
+                                       uint64_t sequence_num,
+                                       base::OnceClosure task)
+    : run_time{run_time}, sequence_num{sequence_num}, task{std::move(task)} {}
+UvTaskRunner::DelayedTask::DelayedTask(DelayedTask&&) = default;
+UvTaskRunner::DelayedTask& UvTaskRunner::DelayedTask::operator=(
+    DelayedTask&&) = default;
+UvTaskRunner::DelayedTask::~DelayedTask() = default;
+
+bool UvTaskRunner::DelayedTask::operator>(const DelayedTask& other) const {
+  return std::tie(run_time, sequence_num) >
+         std::tie(other.run_time, other.sequence_num);
+}
+
+UvTaskRunner::UvTaskRunner(uv_loop_t* loop)
+    : loop_{loop}, loop_thread_{base::PlatformThread::CurrentRef()} {
+  uv_async_init(loop_, wakeup_.get(), &UvTaskRunner::OnWakeUp);
+  wakeup_->data = this;
+  // The async handle is only referenced while tasks are pending, so that an
+  // idle task runner doesn't keep the loop alive.
+  uv_unref(wakeup_.handle());
+
+  uv_timer_init(loop_, timer_.get());
+  timer_->data = this;
+}
 
 UvTaskRunner::~UvTaskRunner() = default;
 
 bool UvTaskRunner::PostDelayedTask(const base::Location& from_here,
                                    base::OnceClosure task,
                                    base::TimeDelta delay) {
-  auto on_timeout = [](uv_timer_t* timer) {
-    auto& tasks = static_cast<UvTaskRunner*>(timer->data)->tasks_;
-    if (auto iter = tasks.find(timer); iter != tasks.end())
-      std::move(tasks.extract(iter).mapped()).Run();
-  };
-
-  auto timer = UvHandle<uv_timer_t>{};
-  timer->data = this;
-  uv_timer_init(loop_, timer.get());
-  uv_timer_start(timer.get(), on_timeout, delay.InMilliseconds(), 0);
-  tasks_.insert_or_assign(std::move(timer), std::move(task));
+  {
+    base::AutoLock lock(lock_);
+    if (delay.is_positive()) {
+      delayed_tasks_.emplace_back(base::TimeTicks::Now() + delay,
+                                  next_sequence_num_++, std::move(task));
+      std::ranges::push_heap(delayed_tasks_, std::greater<>());
+    } else {
+      immediate_tasks_.push_back(std::move(task));
+    }
+  }
+
+  // uv_ref() isn't thread-safe, so only tasks posted from the loop's thread
+  // keep the loop alive, like the uv timers that used to carry them did.
+  if (RunsTasksInCurrentSequence())
+    uv_ref(wakeup_.handle());
+  uv_async_send(wakeup_.get());
   return true;
 }
 
 bool UvTaskRunner::RunsTasksInCurrentSequence() const {
-  return true;
+  return base::PlatformThread::CurrentRef() == loop_thread_;
 }
 
 bool UvTaskRunner::PostNonNestableDelayedTask(const base::Location& from_here,
@@ -42,4 +74,60 @@ bool UvTaskRunner::PostNonNestableDelayedTask(const base::Location& from_here,
   return PostDelayedTask(from_here, std::move(task), delay);
 }
 
+// static
+void UvTaskRunner::OnWakeUp(uv_async_t* handle) {
+  static_cast<UvTaskRunner*>(handle->data)->RunPendingTasks();
+}
+
+// static
+void UvTaskRunner::OnTimeout(uv_timer_t* handle) {
+  static_cast<UvTaskRunner*>(handle->data)->RunPendingTasks();
+}
+
+void UvTaskRunner::RunPendingTasks() {
+  // Keep ourselves alive in case a task drops the last reference.
+  scoped_refptr<UvTaskRunner> self{this};
+
+  // Only run the tasks that are pending now. Tasks posted while these run
+  // signal the async handle again and run on the next loop iteration.
+  base::circular_deque<base::OnceClosure> immediate_tasks;
+  std::vector<base::OnceClosure> due_tasks;
+  {
+    base::AutoLock lock(lock_);
+    immediate_tasks.swap(immediate_tasks_);
+    const base::TimeTicks now = base::TimeTicks::Now();
+    while (!delayed_tasks_.empty() && delayed_tasks_.front().run_time <= now) {
+      std::ranges::pop_heap(delayed_tasks_, std::greater<>());
+      due_tasks.push_back(std::move(delayed_tasks_.back().task));
+      delayed_tasks_.pop_back();
+    }
+  }
+
+  for (auto& task : immediate_tasks)
+    std::move(task).Run();
+  for (auto& task : due_tasks)
+    std::move(task).Run();
+
+  std::optional<base::TimeTicks> next_run_time;
+  bool has_immediate_tasks;
+  {
+    base::AutoLock lock(lock_);
+    has_immediate_tasks = !immediate_tasks_.empty();
+    if (!delayed_tasks_.empty())
+      next_run_time = delayed_tasks_.front().run_time;
+  }
+
+  if (!has_immediate_tasks)
+    uv_unref(wakeup_.handle());
+
+  // An armed timer keeps the loop alive until the next delayed task is due.
+  if (!next_run_time) {
+    uv_timer_stop(timer_.get());
+    return;
+  }
+  const base::TimeDelta delay = *next_run_time - base::TimeTicks::Now();
+  uv_timer_start(timer_.get(), &UvTaskRunner::OnTimeout,
+                 std::max<int64_t>(0, delay.InMillisecondsRoundedUp()), 0);
+}
+
 }  // namespace electron
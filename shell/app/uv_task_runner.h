@@ -5,20 +5,30 @@
 #ifndef ELECTRON_SHELL_APP_UV_TASK_RUNNER_H_
 #define ELECTRON_SHELL_APP_UV_TASK_RUNNER_H_
 
-#include <map>
+#include <cstdint>
+#include <vector>
 
+#include "base/containers/circular_deque.h"
 #include "base/memory/raw_ptr.h"
+#include "base/synchronization/lock.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/thread_annotations.h"
+#include "base/threading/platform_thread.h"
+#include "base/time/time.h"
 #include "shell/common/node_bindings.h"
 
 namespace base {
 class Location;
-class TimeDelta;
 }  // namespace base
 
 namespace electron {
 
 // TaskRunner implementation that posts tasks into libuv's default loop.
+//
+// Immediate tasks are queued and signalled through a single uv_async, and
+// delayed tasks are kept in a min-heap driven by a single uv_timer, so that
+// posting a task doesn't create a uv handle. Tasks may be posted from any
+// thread, but only tasks posted from the loop's thread keep the loop alive.
 class UvTaskRunner : public base::SingleThreadTaskRunner {
  public:
   explicit UvTaskRunner(uv_loop_t* loop);
@@ -37,11 +47,42 @@ class UvTaskRunner : public base::SingleThreadTaskRunner {
                                   base::TimeDelta delay) override;
 
  private:
+  struct DelayedTask {
+    DelayedTask(base::TimeTicks run_time,
+                uint64_t sequence_num,
+                base::OnceClosure task);
+    DelayedTask(DelayedTask&&);
+    DelayedTask& operator=(DelayedTask&&);
+    ~DelayedTask();
+
+    // Orders the heap so that the earliest task, and among tasks due at the
+    // same time the first one posted, is at the top.
+    bool operator>(const DelayedTask& other) const;
+
+    base::TimeTicks run_time;
+    uint64_t sequence_num;
+    base::OnceClosure task;
+  };
+
   ~UvTaskRunner() override;
 
+  static void OnWakeUp(uv_async_t* handle);
+  static void OnTimeout(uv_timer_t* handle);
+
+  // Runs the immediate tasks and the delayed tasks that are due, then arms
+  // the timer for the next delayed task.
+  void RunPendingTasks();
+
   raw_ptr<uv_loop_t> loop_;
+  const base::PlatformThreadRef loop_thread_;
+
+  UvHandle<uv_async_t> wakeup_;
+  UvHandle<uv_timer_t> timer_;
 
-  std::map<UvHandle<uv_timer_t>, base::OnceClosure, UvHandleCompare> tasks_;
+  base::Lock lock_;
+  base::circular_deque<base::OnceClosure> immediate_tasks_ GUARDED_BY(lock_);
+  std::vector<DelayedTask> delayed_tasks_ GUARDED_BY(lock_);
+  uint64_t next_sequence_num_ GUARDED_BY(lock_) = 0;
 };
 
 }  // namespace electron
@@ -1512,8 +1512,12 @@ v8::Local<v8::Promise> App::SetProxy(gin::Arguments* args) {
 
   g_browser_process->system_network_context_manager()
       ->GetContext()
-      ->ForceReloadProxyConfig(base::BindOnce(
-          gin_helper::Promise<void>::ResolvePromise, std::move(promise)));
+      ->ForceReloadProxyConfig(
+          static_cast<BrowserProcessImpl*>(g_browser_process)
+              ->GetResolveProxyHelper()
+              ->InvalidateCacheAndRun(base::BindOnce(
+                  gin_helper::Promise<void>::ResolvePromise,
+                  std::move(promise))));
 
   return handle;
 }
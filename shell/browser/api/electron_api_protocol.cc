@@ -9,14 +9,20 @@
 
 #include "base/command_line.h"
 #include "base/containers/contains.h"
+#include "base/strings/string_util.h"
 #include "content/common/url_schemes.h"
 #include "content/public/browser/child_process_security_policy.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
 #include "shell/browser/browser.h"
+#include "shell/browser/net/directory_url_loader_factory.h"
+#include "shell/browser/net/protocol_response_cache.h"
 #include "shell/browser/protocol_registry.h"
 #include "shell/common/gin_converters/callback_converter.h"
+#include "shell/common/gin_converters/file_path_converter.h"
+#include "shell/common/gin_converters/gurl_converter.h"
 #include "shell/common/gin_converters/net_converter.h"
+#include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
 #include "shell/common/gin_helper/promise.h"
@@ -230,7 +236,8 @@ bool Protocol::UnregisterProtocol(const std::string& scheme,
 }
 
 bool Protocol::IsProtocolRegistered(const std::string& scheme) {
-  return protocol_registry_->FindRegistered(scheme) != nullptr;
+  return protocol_registry_->FindRegistered(scheme) != nullptr ||
+         protocol_registry_->FindDirectoryHandler(scheme) != nullptr;
 }
 
 Protocol::Error Protocol::InterceptProtocol(ProtocolType type,
@@ -251,6 +258,99 @@ bool Protocol::IsProtocolIntercepted(const std::string& scheme) {
   return protocol_registry_->FindIntercepted(scheme) != nullptr;
 }
 
+void Protocol::RegisterDirectoryHandler(const std::string& scheme,
+                                        const base::FilePath& root,
+                                        gin::Arguments* args) {
+  gin_helper::ErrorThrower thrower(args->isolate());
+  if (base::Contains(kBuiltinSchemes, scheme)) {
+    thrower.ThrowError("Cannot register a directory handler for the " +
+                       scheme + " scheme");
+    return;
+  }
+  if (!root.IsAbsolute()) {
+    thrower.ThrowTypeError("rootDir must be an absolute path");
+    return;
+  }
+
+  DirectoryURLLoaderFactory::Options options;
+  options.root = root;
+  gin_helper::Dictionary opts;
+  if (args->GetNext(&opts)) {
+    base::Value::Dict headers;
+    if (opts.Get("headers", &headers)) {
+      for (const auto [name, value] : headers) {
+        if (value.is_string())
+          options.headers.emplace_back(name, value.GetString());
+      }
+    }
+    opts.Get("spaFallback", &options.spa_fallback);
+    base::Value::Dict mime_overrides;
+    if (opts.Get("mimeOverrides", &mime_overrides)) {
+      for (const auto [extension, mime_type] : mime_overrides) {
+        if (!mime_type.is_string())
+          continue;
+        std::string_view key = extension;
+        if (key.starts_with('.'))
+          key.remove_prefix(1);
+        options.mime_overrides[base::ToLowerASCII(key)] =
+            mime_type.GetString();
+      }
+    }
+  }
+
+  if (!protocol_registry_->RegisterDirectoryHandler(scheme, options))
+    thrower.ThrowError(ErrorCodeToString(Error::kRegistered));
+}
+
+void Protocol::SetResponseCache(gin_helper::ErrorThrower thrower,
+                                const std::string& scheme,
+                                const gin_helper::Dictionary& options) {
+  ProtocolResponseCache::Options cache_options;
+  if (double max_size; options.Get("maxSize", &max_size) && max_size >= 0)
+    cache_options.max_size = static_cast<size_t>(max_size);
+  if (double max_entry_size; options.Get("maxEntrySize", &max_entry_size) &&
+                             max_entry_size >= 0)
+    cache_options.max_entry_size = static_cast<size_t>(max_entry_size);
+  if (double max_age; options.Get("defaultMaxAge", &max_age) && max_age > 0)
+    cache_options.default_max_age = base::Seconds(max_age);
+  if (options.Get("diskPath", &cache_options.disk_path) &&
+      !cache_options.disk_path.IsAbsolute()) {
+    thrower.ThrowTypeError("cache.diskPath must be an absolute path");
+    return;
+  }
+  protocol_registry_->SetResponseCache(
+      scheme, base::MakeRefCounted<ProtocolResponseCache>(cache_options));
+}
+
+v8::Local<v8::Value> Protocol::GetResponseCacheStats(
+    v8::Isolate* isolate,
+    const std::string& scheme) {
+  const ProtocolResponseCache* cache =
+      protocol_registry_->FindResponseCache(scheme);
+  if (!cache)
+    return v8::Null(isolate);
+
+  const ProtocolResponseCache::Stats stats = cache->GetStats();
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("hits", static_cast<double>(stats.hits));
+  dict.Set("misses", static_cast<double>(stats.misses));
+  dict.Set("evictions", static_cast<double>(stats.evictions));
+  dict.Set("entryCount", static_cast<double>(stats.entry_count));
+  dict.Set("size", static_cast<double>(stats.size));
+  return dict.GetHandle();
+}
+
+void Protocol::ClearResponseCache(const std::string& scheme,
+                                  gin::Arguments* args) {
+  ProtocolResponseCache* cache = protocol_registry_->FindResponseCache(scheme);
+  if (!cache)
+    return;
+
+  GURL url;
+  args->GetNext(&url);
+  cache->Invalidate(url);
+}
+
 v8::Local<v8::Promise> Protocol::IsProtocolHandled(const std::string& scheme,
                                                    gin::Arguments* args) {
   util::EmitWarning(args->isolate(),
@@ -332,6 +432,11 @@ v8::Local<v8::ObjectTemplate> Protocol::FillObjectTemplate(
                  &Protocol::InterceptProtocolFor<ProtocolType::kFree>)
       .SetMethod("uninterceptProtocol", &Protocol::UninterceptProtocol)
       .SetMethod("isProtocolIntercepted", &Protocol::IsProtocolIntercepted)
+      .SetMethod("registerDirectoryHandler",
+                 &Protocol::RegisterDirectoryHandler)
+      .SetMethod("_setResponseCache", &Protocol::SetResponseCache)
+      .SetMethod("getResponseCacheStats", &Protocol::GetResponseCacheStats)
+      .SetMethod("clearResponseCache", &Protocol::ClearResponseCache)
       .Build();
 }
 
@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
 #include "content/public/browser/content_browser_client.h"
 #include "gin/wrappable.h"
@@ -20,6 +21,10 @@ template <typename T>
 class Handle;
 }  // namespace gin
 
+namespace gin_helper {
+class Dictionary;
+}  // namespace gin_helper
+
 namespace electron {
 
 class ProtocolRegistry;
@@ -84,6 +89,19 @@ class Protocol final : public gin::Wrappable<Protocol>,
   bool UninterceptProtocol(const std::string& scheme, gin::Arguments* args);
   bool IsProtocolIntercepted(const std::string& scheme);
 
+  // Serves |scheme| natively from the files under a directory.
+  void RegisterDirectoryHandler(const std::string& scheme,
+                                const base::FilePath& root,
+                                gin::Arguments* args);
+
+  // Response cache of schemes registered through protocol.handle().
+  void SetResponseCache(gin_helper::ErrorThrower thrower,
+                        const std::string& scheme,
+                        const gin_helper::Dictionary& options);
+  v8::Local<v8::Value> GetResponseCacheStats(v8::Isolate* isolate,
+                                             const std::string& scheme);
+  void ClearResponseCache(const std::string& scheme, gin::Arguments* args);
+
   // Old async version of IsProtocolRegistered.
   v8::Local<v8::Promise> IsProtocolHandled(const std::string& scheme,
                                            gin::Arguments* args);
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "base/command_line.h"
+#include "base/containers/contains.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/containers/map_util.h"
 #include "base/files/file_enumerator.h"
@@ -73,7 +74,9 @@
 #include "shell/browser/javascript_environment.h"
 #include "shell/browser/media/media_device_id_salt.h"
 #include "shell/browser/net/cert_verifier_client.h"
+#include "shell/browser/net/host_prefetcher.h"
 #include "shell/browser/net/resolve_host_function.h"
+#include "shell/browser/renderer_process_pool.h"
 #include "shell/browser/session_preferences.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/content_converter.h"
@@ -627,6 +630,19 @@ v8::Local<v8::Promise> Session::ResolveProxy(gin::Arguments* args) {
   return handle;
 }
 
+v8::Local<v8::Value> Session::GetResolveProxyStats() {
+  const ResolveProxyHelper::Stats stats =
+      browser_context_->GetResolveProxyHelper()->GetStats();
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate_);
+  dict.Set("queueDepth", static_cast<double>(stats.queue_depth));
+  dict.Set("activeLookups", static_cast<double>(stats.active_lookups));
+  dict.Set("cacheHits", static_cast<double>(stats.cache_hits));
+  dict.Set("lookups", static_cast<double>(stats.lookups));
+  dict.Set("averageLatency", stats.average_latency.InMillisecondsF());
+  dict.Set("maxLatency", stats.max_latency.InMillisecondsF());
+  return dict.GetHandle();
+}
+
 v8::Local<v8::Promise> Session::ResolveHost(
     std::string host,
     std::optional<network::mojom::ResolveHostParametersPtr> params) {
@@ -762,21 +778,30 @@ v8::Local<v8::Promise> Session::SetProxy(gin::Arguments* args) {
           createProxyConfig(proxy_mode, pac_url, proxy_rules, bypass_list)},
       WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
 
+  // The pref reaches the network service asynchronously, so the cached proxies
+  // are only dropped once the configuration has been reloaded there.
   base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
-      FROM_HERE, base::BindOnce(gin_helper::Promise<void>::ResolvePromise,
-                                std::move(promise)));
+      FROM_HERE,
+      base::BindOnce(&Session::ReloadProxyConfig, weak_factory_.GetWeakPtr(),
+                     std::move(promise)));
 
   return handle;
 }
 
+void Session::ReloadProxyConfig(gin_helper::Promise<void> promise) {
+  browser_context_->GetDefaultStoragePartition()
+      ->GetNetworkContext()
+      ->ForceReloadProxyConfig(
+          browser_context_->GetResolveProxyHelper()->InvalidateCacheAndRun(
+              base::BindOnce(gin_helper::Promise<void>::ResolvePromise,
+                             std::move(promise))));
+}
+
 v8::Local<v8::Promise> Session::ForceReloadProxyConfig() {
   gin_helper::Promise<void> promise(isolate_);
   auto handle = promise.GetHandle();
 
-  browser_context_->GetDefaultStoragePartition()
-      ->GetNetworkContext()
-      ->ForceReloadProxyConfig(base::BindOnce(
-          gin_helper::Promise<void>::ResolvePromise, std::move(promise)));
+  ReloadProxyConfig(std::move(promise));
 
   return handle;
 }
@@ -1339,24 +1364,32 @@ v8::Local<v8::Value> Session::NetLog(v8::Isolate* isolate) {
   return net_log_.Get(isolate);
 }
 
-static void StartPreconnectOnUI(ElectronBrowserContext* browser_context,
-                                const GURL& url,
-                                int num_sockets_to_preconnect) {
-  url::Origin origin = url::Origin::Create(url);
-  std::vector<predictors::PreconnectRequest> requests = {
-      {url::Origin::Create(url), num_sockets_to_preconnect,
-       net::NetworkAnonymizationKey::CreateSameSite(
-           net::SchemefulSite(origin))}};
-  browser_context->GetPreconnectManager()->Start(url, requests);
+static void StartPreconnectOnUI(
+    ElectronBrowserContext* browser_context,
+    const std::vector<std::pair<GURL, int>>& preconnects) {
+  // The manager tracks, and dedupes, preconnects by the URL they are started
+  // for, so each one gets its own job.
+  for (const auto& [url, num_sockets_to_preconnect] : preconnects) {
+    url::Origin origin = url::Origin::Create(url);
+    std::vector<predictors::PreconnectRequest> requests;
+    requests.emplace_back(origin, num_sockets_to_preconnect,
+                          net::NetworkAnonymizationKey::CreateSameSite(
+                              net::SchemefulSite(origin)));
+    browser_context->GetPreconnectManager()->Start(url, std::move(requests));
+  }
 }
 
-void Session::Preconnect(const gin_helper::Dictionary& options,
-                         gin::Arguments* args) {
+// Reads the |url| and |numSockets| of a preconnect, throwing on |args| when
+// they are invalid.
+static std::optional<std::pair<GURL, int>> ParsePreconnectOptions(
+    const gin_helper::Dictionary& options,
+    gin::Arguments* args,
+    std::string_view method) {
   GURL url;
   if (!options.Get("url", &url) || !url.is_valid()) {
-    args->ThrowTypeError(
-        "Must pass non-empty valid url to session.preconnect.");
-    return;
+    args->ThrowTypeError(absl::StrFormat(
+        "Must pass non-empty valid url to session.%s.", method));
+    return std::nullopt;
   }
   int num_sockets_to_preconnect = 1;
   if (options.Get("numSockets", &num_sockets_to_preconnect)) {
@@ -1367,15 +1400,137 @@ void Session::Preconnect(const gin_helper::Dictionary& options,
       args->ThrowTypeError(
           absl::StrFormat("numSocketsToPreconnect is outside range [%d,%d]",
                           kMinSocketsToPreconnect, kMaxSocketsToPreconnect));
-      return;
+      return std::nullopt;
     }
   }
 
   DCHECK_GT(num_sockets_to_preconnect, 0);
+  return std::make_pair(url, num_sockets_to_preconnect);
+}
+
+void Session::Preconnect(const gin_helper::Dictionary& options,
+                         gin::Arguments* args) {
+  auto preconnect = ParsePreconnectOptions(options, args, "preconnect");
+  if (!preconnect)
+    return;
+
   content::GetUIThreadTaskRunner({})->PostTask(
       FROM_HERE,
       base::BindOnce(&StartPreconnectOnUI, base::Unretained(browser_context()),
-                     url, num_sockets_to_preconnect));
+                     std::vector{std::move(*preconnect)}));
+}
+
+void Session::PreconnectMany(gin::Arguments* args) {
+  std::vector<gin_helper::Dictionary> list;
+  if (!args->GetNext(&list)) {
+    args->ThrowTypeError("Must pass an array of preconnect options");
+    return;
+  }
+
+  std::vector<std::pair<GURL, int>> preconnects;
+  for (const auto& options : list) {
+    auto preconnect = ParsePreconnectOptions(options, args, "preconnectMany");
+    if (!preconnect)
+      return;
+    preconnects.push_back(std::move(*preconnect));
+  }
+  if (preconnects.empty())
+    return;
+
+  // The preconnect manager resolves and connects to a few origins at a time.
+  content::GetUIThreadTaskRunner({})->PostTask(
+      FROM_HERE,
+      base::BindOnce(&StartPreconnectOnUI, base::Unretained(browser_context()),
+                     std::move(preconnects)));
+}
+
+v8::Local<v8::Promise> Session::PrefetchDNS(gin::Arguments* args) {
+  gin_helper::Promise<base::Value::List> promise(isolate_);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  std::vector<std::string> hosts;
+  if (!args->GetNext(&hosts) || base::Contains(hosts, std::string())) {
+    promise.RejectWithErrorMessage("Must pass an array of non-empty hosts");
+    return handle;
+  }
+
+  net::RequestPriority priority = net::IDLE;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    static constexpr auto Lookup =
+        base::MakeFixedFlatMap<std::string_view, net::RequestPriority>({
+            {"throttled", net::THROTTLED},
+            {"idle", net::IDLE},
+            {"lowest", net::LOWEST},
+            {"low", net::LOW},
+            {"medium", net::MEDIUM},
+            {"highest", net::HIGHEST},
+        });
+    if (std::string value; options.Get("priority", &value)) {
+      auto iter = Lookup.find(value);
+      if (iter == Lookup.end()) {
+        args->ThrowTypeError(
+            "Invalid priority '" + value +
+            "', must be one of throttled, idle, lowest, low, medium or "
+            "highest");
+        return {};
+      }
+      priority = iter->second;
+    }
+  }
+
+  if (!host_prefetcher_)
+    host_prefetcher_ = std::make_unique<HostPrefetcher>(browser_context());
+  host_prefetcher_->Prefetch(
+      hosts, priority,
+      base::BindOnce(
+          [](gin_helper::Promise<base::Value::List> promise,
+             std::vector<HostPrefetcher::Result> results) {
+            base::Value::List list;
+            for (const auto& result : results) {
+              auto dict = base::Value::Dict()
+                              .Set("host", result.host)
+                              .Set("duration",
+                                   result.duration.InMillisecondsF());
+              if (result.net_error != net::OK)
+                dict.Set("error", net::ErrorToString(result.net_error));
+              list.Append(std::move(dict));
+            }
+            promise.Resolve(list);
+          },
+          std::move(promise)));
+
+  return handle;
+}
+
+void Session::SetRendererProcessPool(gin::Arguments* args) {
+  // Each process of the pool costs as much memory as a blank page.
+  static constexpr int kMaxPoolSize = 8;
+
+  gin_helper::Dictionary options;
+  int size = 0;
+  if (!args->GetNext(&options) || !options.Get("size", &size) || size < 0 ||
+      size > kMaxPoolSize) {
+    args->ThrowTypeError("Must pass a size between 0 and 8");
+    return;
+  }
+
+  gin_helper::Dictionary web_preferences =
+      gin_helper::Dictionary::CreateEmpty(args->isolate());
+  options.Get("webPreferences", &web_preferences);
+  RendererProcessPool::SetForBrowserContext(browser_context(), size,
+                                            web_preferences);
+}
+
+v8::Local<v8::Value> Session::GetRendererProcessPoolStats(
+    v8::Isolate* isolate) {
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  auto* pool = RendererProcessPool::FromBrowserContext(browser_context());
+  dict.Set("size", pool ? static_cast<uint32_t>(pool->size()) : 0);
+  dict.Set("available", pool ? static_cast<uint32_t>(pool->available()) : 0);
+  dict.Set("hits", pool ? pool->hits() : 0);
+  dict.Set("misses", pool ? pool->misses() : 0);
+  return dict.GetHandle();
 }
 
 v8::Local<v8::Promise> Session::CloseAllConnections() {
@@ -1728,6 +1883,7 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
   gin::ObjectTemplateBuilder(isolate, GetClassName(), templ)
       .SetMethod("resolveHost", &Session::ResolveHost)
       .SetMethod("resolveProxy", &Session::ResolveProxy)
+      .SetMethod("getResolveProxyStats", &Session::GetResolveProxyStats)
       .SetMethod("getCacheSize", &Session::GetCacheSize)
       .SetMethod("clearCache", &Session::ClearCache)
       .SetMethod("clearStorageData", &Session::ClearStorageData)
@@ -1791,7 +1947,12 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
                    &Session::SetSpellCheckerEnabled)
 #endif
       .SetMethod("preconnect", &Session::Preconnect)
+      .SetMethod("preconnectMany", &Session::PreconnectMany)
+      .SetMethod("prefetchDNS", &Session::PrefetchDNS)
       .SetMethod("closeAllConnections", &Session::CloseAllConnections)
+      .SetMethod("setRendererProcessPool", &Session::SetRendererProcessPool)
+      .SetMethod("getRendererProcessPoolStats",
+                 &Session::GetRendererProcessPoolStats)
       .SetMethod("getStoragePath", &Session::GetPath)
       .SetMethod("setCodeCachePath", &Session::SetCodeCachePath)
       .SetMethod("clearCodeCaches", &Session::ClearCodeCaches)
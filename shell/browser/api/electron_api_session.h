@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SESSION_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SESSION_H_
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -44,6 +45,8 @@ class Handle;
 namespace gin_helper {
 class Dictionary;
 class ErrorThrower;
+template <typename T>
+class Promise;
 }  // namespace gin_helper
 
 namespace net {
@@ -53,6 +56,7 @@ class ProxyConfig;
 namespace electron {
 
 class ElectronBrowserContext;
+class HostPrefetcher;
 struct PreloadScript;
 
 namespace api {
@@ -105,6 +109,7 @@ class Session final : public gin::Wrappable<Session>,
       std::string host,
       std::optional<network::mojom::ResolveHostParametersPtr> params);
   v8::Local<v8::Promise> ResolveProxy(gin::Arguments* args);
+  v8::Local<v8::Value> GetResolveProxyStats();
   v8::Local<v8::Promise> GetCacheSize();
   v8::Local<v8::Promise> ClearCache();
   v8::Local<v8::Promise> ClearStorageData(gin::Arguments* args);
@@ -154,7 +159,11 @@ class Session final : public gin::Wrappable<Session>,
   v8::Local<v8::Value> WebRequest(v8::Isolate* isolate);
   v8::Local<v8::Value> NetLog(v8::Isolate* isolate);
   void Preconnect(const gin_helper::Dictionary& options, gin::Arguments* args);
+  void PreconnectMany(gin::Arguments* args);
+  v8::Local<v8::Promise> PrefetchDNS(gin::Arguments* args);
   v8::Local<v8::Promise> CloseAllConnections();
+  void SetRendererProcessPool(gin::Arguments* args);
+  v8::Local<v8::Value> GetRendererProcessPoolStats(v8::Isolate* isolate);
   v8::Local<v8::Value> GetPath(v8::Isolate* isolate);
   void SetCodeCachePath(gin::Arguments* args);
   v8::Local<v8::Promise> ClearCodeCaches(const gin_helper::Dictionary& options);
@@ -196,6 +205,9 @@ class Session final : public gin::Wrappable<Session>,
  private:
   void SetDisplayMediaRequestHandler(v8::Isolate* isolate,
                                      v8::Local<v8::Value> val);
+  // Reloads the proxy configuration in the network service, then drops the
+  // cached proxies and resolves |promise|.
+  void ReloadProxyConfig(gin_helper::Promise<void> promise);
 
   // Cached gin_helper::Wrappable objects.
   v8::Global<v8::Value> cookies_;
@@ -210,6 +222,9 @@ class Session final : public gin::Wrappable<Session>,
   // The client id to enable the network throttler.
   base::UnguessableToken network_emulation_token_;
 
+  // Created by the first prefetchDNS() call.
+  std::unique_ptr<HostPrefetcher> host_prefetcher_;
+
   const raw_ref<ElectronBrowserContext> browser_context_;
 
   base::WeakPtrFactory<Session> weak_factory_{this};
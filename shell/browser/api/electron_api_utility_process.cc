@@ -423,6 +423,10 @@ void UtilityProcessWrapper::OnV8FatalError(const std::string& location,
   EmitWithoutEvent("error", "FatalError", location, report);
 }
 
+void UtilityProcessWrapper::OnReady() {
+  EmitWithoutEvent("ready");
+}
+
 // static
 raw_ptr<UtilityProcessWrapper> UtilityProcessWrapper::FromProcessId(
     base::ProcessId pid) {
@@ -459,6 +463,10 @@ gin::Handle<UtilityProcessWrapper> UtilityProcessWrapper::Create(
     args->ThrowTypeError("Invalid value for args");
     return {};
   }
+  if (dict.Has("preload") && !dict.Get("preload", &params->preload)) {
+    args->ThrowTypeError("Invalid value for preload");
+    return {};
+  }
 
   gin_helper::Dictionary opts;
   if (dict.Get("options", &opts)) {
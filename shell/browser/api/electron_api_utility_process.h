@@ -85,6 +85,7 @@ class UtilityProcessWrapper final
   // node::mojom::NodeServiceClient
   void OnV8FatalError(const std::string& location,
                       const std::string& report) override;
+  void OnReady() override;
 
   // content::ServiceProcessHost::Observer
   void OnServiceProcessTerminatedNormally(
@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/electron_api_web_contents.h"
 
+#include <algorithm>
 #include <limits>
 #include <list>
 #include <memory>
@@ -24,6 +25,7 @@
 #include "base/strings/strcat.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/current_thread.h"
+#include "base/task/thread_pool.h"
 #include "base/threading/scoped_blocking_call.h"
 #include "base/values.h"
 #include "chrome/browser/browser_process.h"
@@ -88,6 +90,7 @@
 #include "shell/browser/api/electron_api_debugger.h"
 #include "shell/browser/api/electron_api_session.h"
 #include "shell/browser/api/electron_api_web_frame_main.h"
+#include "shell/browser/api/frame_encoder.h"
 #include "shell/browser/api/frame_subscriber.h"
 #include "shell/browser/api/message_port.h"
 #include "shell/browser/browser.h"
@@ -100,6 +103,7 @@
 #include "shell/browser/native_window.h"
 #include "shell/browser/osr/osr_render_widget_host_view.h"
 #include "shell/browser/osr/osr_web_contents_view.h"
+#include "shell/browser/renderer_process_pool.h"
 #include "shell/browser/session_preferences.h"
 #include "shell/browser/ui/drag_util.h"
 #include "shell/browser/ui/file_dialog.h"
@@ -154,6 +158,9 @@
 #include "ui/base/cursor/mojom/cursor_type.mojom-shared.h"
 #include "ui/display/screen.h"
 #include "ui/events/base_event_utils.h"
+#include "ui/gfx/codec/jpeg_codec.h"
+#include "ui/gfx/codec/png_codec.h"
+#include "ui/gfx/codec/webp_codec.h"
 
 #if BUILDFLAG(IS_MAC)
 #include "ui/base/cocoa/defaults_utils.h"
@@ -563,6 +570,92 @@ void OnCapturePageDone(gin_helper::Promise<gfx::Image> promise,
   capture_handle.RunAndReset();
 }
 
+enum class CaptureFormat { kBGRA, kPNG, kJPEG, kWebP };
+
+std::optional<std::vector<uint8_t>> EncodeCapturedBitmap(
+    const SkBitmap& bitmap,
+    CaptureFormat format,
+    int quality) {
+  switch (format) {
+    case CaptureFormat::kBGRA: {
+      // N32 is RGBA on some platforms, so ask for BGRA explicitly.
+      const auto info = SkImageInfo::Make(
+          bitmap.dimensions(), kBGRA_8888_SkColorType, kPremul_SkAlphaType);
+      std::vector<uint8_t> pixels(info.computeMinByteSize());
+      if (!bitmap.readPixels(info, pixels.data(), info.minRowBytes(), 0, 0))
+        return std::nullopt;
+      return pixels;
+    }
+    case CaptureFormat::kPNG:
+      return gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false);
+    case CaptureFormat::kJPEG:
+      return gfx::JPEGCodec::Encode(bitmap, quality);
+    case CaptureFormat::kWebP:
+      return gfx::WebpCodec::Encode(bitmap, quality);
+  }
+}
+
+// Raw pixels are resolved along with their dimensions, as the caller can't
+// tell them from the scale factor, the rect and the options.
+void OnCapturePageEncoded(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                          CaptureFormat format,
+                          gfx::Size size,
+                          std::optional<std::vector<uint8_t>> data) {
+  if (!data) {
+    promise.RejectWithErrorMessage("Failed to encode captured page");
+    return;
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(
+      v8::Local<v8::Context>::New(isolate, promise.GetContext()));
+
+  v8::Local<v8::Object> buffer =
+      electron::Buffer::Copy(isolate, *data).ToLocalChecked();
+  if (format != CaptureFormat::kBGRA) {
+    promise.Resolve(buffer);
+    return;
+  }
+  auto bitmap = gin_helper::Dictionary::CreateEmpty(isolate);
+  bitmap.Set("data", buffer);
+  bitmap.Set("width", size.width());
+  bitmap.Set("height", size.height());
+  promise.Resolve(bitmap.GetHandle());
+}
+
+void OnCapturePageDoneEncode(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                             base::ScopedClosureRunner capture_handle,
+                             CaptureFormat format,
+                             int quality,
+                             const SkBitmap& bitmap) {
+  auto ui_task_runner = content::GetUIThreadTaskRunner({});
+  if (!ui_task_runner->RunsTasksInCurrentSequence()) {
+    ui_task_runner->PostTask(
+        FROM_HERE,
+        base::BindOnce(&OnCapturePageDoneEncode, std::move(promise),
+                       std::move(capture_handle), format, quality, bitmap));
+    return;
+  }
+
+  capture_handle.RunAndReset();
+
+  if (bitmap.drawsNothing()) {
+    OnCapturePageEncoded(std::move(promise), format, gfx::Size(),
+                         std::vector<uint8_t>());
+    return;
+  }
+
+  // Encoding a large capture can take tens of milliseconds, keep it off the
+  // UI thread.
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&EncodeCapturedBitmap, bitmap, format, quality),
+      base::BindOnce(&OnCapturePageEncoded, std::move(promise), format,
+                     gfx::Size(bitmap.width(), bitmap.height())));
+}
+
 std::optional<base::TimeDelta> GetCursorBlinkInterval() {
 #if BUILDFLAG(IS_MAC)
   std::optional<base::TimeDelta> system_value(
@@ -879,6 +972,10 @@ WebContents::WebContents(v8::Isolate* isolate,
   } else {
     content::WebContents::CreateParams params(session->browser_context());
     params.initially_hidden = !initially_shown;
+    // Take over a renderer process launched ahead of time, if there is one.
+    if (auto* pool =
+            RendererProcessPool::FromBrowserContext(session->browser_context()))
+      params.site_instance = pool->Claim(options);
     web_contents = content::WebContents::Create(params);
   }
 
@@ -2976,6 +3073,50 @@ void OnPDFCreated(gin_helper::Promise<v8::Local<v8::Value>> promise,
 
   promise.Resolve(buffer);
 }
+
+void OnPDFWritten(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                  const base::FilePath& path,
+                  bool success) {
+  if (!success) {
+    promise.RejectWithErrorMessage("Failed to write PDF to " +
+                                   path.AsUTF8Unsafe());
+    return;
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(
+      v8::Local<v8::Context>::New(isolate, promise.GetContext()));
+
+  promise.Resolve(v8::Undefined(isolate));
+}
+
+// Writes the PDF on the thread pool so that neither the write nor a Buffer
+// holding the document ever touch the main thread.
+void OnPDFCreatedForFile(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                         const base::FilePath& path,
+                         print_to_pdf::PdfPrintResult print_result,
+                         scoped_refptr<base::RefCountedMemory> data) {
+  if (print_result != print_to_pdf::PdfPrintResult::kPrintSuccess) {
+    promise.RejectWithErrorMessage(
+        "Failed to generate PDF: " +
+        print_to_pdf::PdfPrintResultToString(print_result));
+    return;
+  }
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::BLOCK_SHUTDOWN},
+      base::BindOnce(
+          [](const base::FilePath& path,
+             scoped_refptr<base::RefCountedMemory> data) {
+            return base::WriteFile(path, *data);
+          },
+          path, std::move(data)),
+      base::BindOnce(&OnPDFWritten, std::move(promise), path));
+}
 }  // namespace
 
 void WebContents::Print(gin::Arguments* args) {
@@ -3196,8 +3337,14 @@ v8::Local<v8::Promise> WebContents::PrintToPDF(const base::Value& settings) {
       absl::get<printing::mojom::PrintPagesParamsPtr>(print_pages_params));
   params->params->document_cookie = unique_id.value_or(0);
 
-  manager->PrintToPdf(rfh, page_ranges, std::move(params),
-                      base::BindOnce(&OnPDFCreated, std::move(promise)));
+  // When a path is given the document is written there instead of being
+  // resolved as a Buffer.
+  const std::string* path = settings.GetDict().FindString("path");
+  manager->PrintToPdf(
+      rfh, page_ranges, std::move(params),
+      path ? base::BindOnce(&OnPDFCreatedForFile, std::move(promise),
+                            base::FilePath::FromUTF8Unsafe(*path))
+           : base::BindOnce(&OnPDFCreated, std::move(promise)));
 
   return handle;
 }
@@ -3452,6 +3599,102 @@ void WebContents::EndFrameSubscription() {
   frame_subscriber_.reset();
 }
 
+void WebContents::BeginFrameEncoding(gin::Arguments* args) {
+  gin_helper::ErrorThrower thrower(args->isolate());
+  gin_helper::Dictionary options;
+  if (!args->GetNext(&options)) {
+    thrower.ThrowTypeError("Expected an options object");
+    return;
+  }
+
+  FrameEncoder::Options encoder_options;
+  std::string codec = "vp8";
+  options.Get("codec", &codec);
+  if (codec == "vp8") {
+    encoder_options.codec = FrameEncoder::Codec::kVP8;
+  } else if (codec == "vp9") {
+    encoder_options.codec = FrameEncoder::Codec::kVP9;
+  } else if (codec == "h264") {
+    encoder_options.codec = FrameEncoder::Codec::kH264;
+  } else {
+    thrower.ThrowTypeError("Unknown codec: " + codec);
+    return;
+  }
+  if (!FrameEncoder::IsCodecSupported(encoder_options.codec)) {
+    thrower.ThrowError("Codec is not supported by this build: " + codec);
+    return;
+  }
+
+  options.Get("bitrate", &encoder_options.bitrate);
+  options.Get("keyframeInterval", &encoder_options.keyframe_interval);
+  options.Get("frameRate", &encoder_options.frame_rate);
+  options.Get("path", &encoder_options.path);
+  if (!encoder_options.path.empty() && !encoder_options.path.IsAbsolute()) {
+    thrower.ThrowTypeError("'path' must be an absolute path");
+    return;
+  }
+  if (encoder_options.bitrate == 0 || encoder_options.keyframe_interval <= 0 ||
+      encoder_options.frame_rate <= 0) {
+    thrower.ThrowRangeError(
+        "'bitrate', 'keyframeInterval' and 'frameRate' must be positive");
+    return;
+  }
+
+  base::RepeatingCallback<void(v8::Local<v8::Value>)> callback;
+  if (encoder_options.path.empty() && !args->GetNext(&callback)) {
+    thrower.ThrowTypeError("Either 'path' or a callback is required");
+    return;
+  }
+
+  auto on_chunk = base::BindRepeating(
+      [](const base::RepeatingCallback<void(v8::Local<v8::Value>)>& callback,
+         std::unique_ptr<v8::BackingStore> data, bool key_frame,
+         base::TimeDelta timestamp) {
+        v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+        v8::HandleScope handle_scope(isolate);
+        const size_t size = data->ByteLength();
+        // The encoder already copied the chunk into adoptable memory.
+        auto buffer = v8::ArrayBuffer::New(isolate, std::move(data));
+        auto chunk = gin_helper::Dictionary::CreateEmpty(isolate);
+        chunk.Set("data",
+                  node::Buffer::New(isolate, buffer, 0, size).ToLocalChecked());
+        chunk.Set("keyFrame", key_frame);
+        chunk.Set("timestamp", timestamp.InMillisecondsF());
+        callback.Run(chunk.GetHandle());
+      },
+      std::move(callback));
+
+  frame_encoding_subscriber_ = std::make_unique<FrameSubscriber>(
+      web_contents(),
+      std::make_unique<FrameEncoder>(encoder_options, std::move(on_chunk)));
+}
+
+v8::Local<v8::Promise> WebContents::EndFrameEncoding(v8::Isolate* isolate) {
+  gin_helper::Promise<void> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!frame_encoding_subscriber_) {
+    promise.Resolve();
+    return handle;
+  }
+
+  std::unique_ptr<FrameEncoder> encoder =
+      frame_encoding_subscriber_->TakeEncoder();
+  frame_encoding_subscriber_.reset();
+
+  FrameEncoder* encoder_ptr = encoder.get();
+  encoder_ptr->Flush(base::BindOnce(
+      [](std::unique_ptr<FrameEncoder> encoder,
+         gin_helper::Promise<void> promise, std::optional<std::string> error) {
+        if (error)
+          promise.RejectWithErrorMessage(*error);
+        else
+          promise.Resolve();
+      },
+      std::move(encoder), std::move(promise)));
+  return handle;
+}
+
 void WebContents::StartDrag(const gin_helper::Dictionary& item,
                             gin::Arguments* args) {
   base::FilePath file;
@@ -3484,31 +3727,88 @@ void WebContents::StartDrag(const gin_helper::Dictionary& item,
 }
 
 v8::Local<v8::Promise> WebContents::CapturePage(gin::Arguments* args) {
-  gin_helper::Promise<gfx::Image> promise(args->isolate());
-  v8::Local<v8::Promise> handle = promise.GetHandle();
+  return CapturePageImpl(args, /*to_buffer=*/false);
+}
+
+v8::Local<v8::Promise> WebContents::CapturePageToBuffer(gin::Arguments* args) {
+  return CapturePageImpl(args, /*to_buffer=*/true);
+}
+
+v8::Local<v8::Promise> WebContents::CapturePageImpl(gin::Arguments* args,
+                                                    bool to_buffer) {
+  v8::Isolate* isolate = args->isolate();
 
   gfx::Rect rect;
   args->GetNext(&rect);
 
   bool stay_hidden = false;
   bool stay_awake = false;
+  float scale = 1.0f;
+  gfx::Size max_size;
+  std::string format_name = "png";
+  int quality = 90;
   if (args && args->Length() == 2) {
     gin_helper::Dictionary options;
     if (args->GetNext(&options)) {
       options.Get("stayHidden", &stay_hidden);
       options.Get("stayAwake", &stay_awake);
+      options.Get("scale", &scale);
+      options.Get("maxSize", &max_size);
+      if (to_buffer) {
+        options.Get("format", &format_name);
+        options.Get("quality", &quality);
+      }
     }
   }
 
+  static constexpr auto kCaptureFormats =
+      base::MakeFixedFlatMap<std::string_view, CaptureFormat>({
+          {"bgra", CaptureFormat::kBGRA},
+          {"jpeg", CaptureFormat::kJPEG},
+          {"png", CaptureFormat::kPNG},
+          {"webp", CaptureFormat::kWebP},
+      });
+  const auto format_iter = kCaptureFormats.find(format_name);
+  if (format_iter == kCaptureFormats.end()) {
+    gin_helper::ErrorThrower(isolate).ThrowTypeError(
+        "Invalid capture format: " + format_name);
+    return {};
+  }
+  const CaptureFormat format = format_iter->second;
+  if (scale <= 0.0f || quality < 0 || quality > 100) {
+    gin_helper::ErrorThrower(isolate).ThrowRangeError(
+        "'scale' must be positive and 'quality' must be within 0-100");
+    return {};
+  }
+
+  std::optional<gin_helper::Promise<gfx::Image>> image_promise;
+  std::optional<gin_helper::Promise<v8::Local<v8::Value>>> buffer_promise;
+  v8::Local<v8::Promise> handle;
+  if (to_buffer) {
+    buffer_promise.emplace(isolate);
+    handle = buffer_promise->GetHandle();
+  } else {
+    image_promise.emplace(isolate);
+    handle = image_promise->GetHandle();
+  }
+
   auto* const view = web_contents()->GetRenderWidgetHostView();
   if (!view || view->GetViewBounds().size().IsEmpty()) {
-    promise.Resolve(gfx::Image());
+    if (image_promise)
+      image_promise->Resolve(gfx::Image());
+    else
+      OnCapturePageEncoded(std::move(*buffer_promise), format, gfx::Size(),
+                           std::vector<uint8_t>());
     return handle;
   }
 
   if (!view->IsSurfaceAvailableForCopy()) {
-    promise.RejectWithErrorMessage(
-        "Current display surface not available for capture");
+    static constexpr std::string_view kUnavailable =
+        "Current display surface not available for capture";
+    if (image_promise)
+      image_promise->RejectWithErrorMessage(kUnavailable);
+    else
+      buffer_promise->RejectWithErrorMessage(kUnavailable);
     return handle;
   }
 
@@ -3524,15 +3824,36 @@ v8::Local<v8::Promise> WebContents::CapturePage(gin::Arguments* args) {
   // current system, increase the requested bitmap size to capture it all.
   gfx::Size bitmap_size = view_size;
   const gfx::NativeView native_view = view->GetNativeView();
-  const float scale = display::Screen::GetScreen()
-                          ->GetDisplayNearestView(native_view)
-                          .device_scale_factor();
-  if (scale > 1.0f)
-    bitmap_size = gfx::ScaleToCeiledSize(view_size, scale);
-
-  view->CopyFromSurface(gfx::Rect(rect.origin(), view_size), bitmap_size,
-                        base::BindOnce(&OnCapturePageDone, std::move(promise),
-                                       std::move(capture_handle)));
+  const float device_scale = display::Screen::GetScreen()
+                                 ->GetDisplayNearestView(native_view)
+                                 .device_scale_factor();
+  if (device_scale > 1.0f)
+    bitmap_size = gfx::ScaleToCeiledSize(view_size, device_scale);
+
+  // Let viz produce the scaled copy so that only the requested pixels ever
+  // leave the GPU process.
+  if (scale != 1.0f)
+    bitmap_size = gfx::ScaleToCeiledSize(bitmap_size, scale);
+  if (!max_size.IsEmpty() && (bitmap_size.width() > max_size.width() ||
+                              bitmap_size.height() > max_size.height())) {
+    const float fit = std::min(
+        static_cast<float>(max_size.width()) / bitmap_size.width(),
+        static_cast<float>(max_size.height()) / bitmap_size.height());
+    bitmap_size = gfx::ScaleToFlooredSize(bitmap_size, fit);
+    bitmap_size.SetToMax(gfx::Size(1, 1));
+  }
+
+  if (image_promise) {
+    view->CopyFromSurface(
+        gfx::Rect(rect.origin(), view_size), bitmap_size,
+        base::BindOnce(&OnCapturePageDone, std::move(*image_promise),
+                       std::move(capture_handle)));
+  } else {
+    view->CopyFromSurface(
+        gfx::Rect(rect.origin(), view_size), bitmap_size,
+        base::BindOnce(&OnCapturePageDoneEncode, std::move(*buffer_promise),
+                       std::move(capture_handle), format, quality));
+  }
   return handle;
 }
 
@@ -4405,6 +4726,8 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("sendInputEvent", &WebContents::SendInputEvent)
       .SetMethod("beginFrameSubscription", &WebContents::BeginFrameSubscription)
       .SetMethod("endFrameSubscription", &WebContents::EndFrameSubscription)
+      .SetMethod("beginFrameEncoding", &WebContents::BeginFrameEncoding)
+      .SetMethod("endFrameEncoding", &WebContents::EndFrameEncoding)
       .SetMethod("startDrag", &WebContents::StartDrag)
       .SetMethod("attachToIframe", &WebContents::AttachToIframe)
       .SetMethod("detachFromOuterFrame", &WebContents::DetachFromOuterFrame)
@@ -4440,6 +4763,7 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
                  &WebContents::ShowDefinitionForSelection)
       .SetMethod("copyImageAt", &WebContents::CopyImageAt)
       .SetMethod("capturePage", &WebContents::CapturePage)
+      .SetMethod("capturePageToBuffer", &WebContents::CapturePageToBuffer)
       .SetMethod("setEmbedder", &WebContents::SetEmbedder)
       .SetMethod("setDevToolsWebContents", &WebContents::SetDevToolsWebContents)
       .SetMethod("isBeingCaptured", &WebContents::IsBeingCaptured)
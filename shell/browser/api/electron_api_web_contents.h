@@ -297,6 +297,10 @@ class WebContents final : public ExclusiveAccessContext,
   void BeginFrameSubscription(gin::Arguments* args);
   void EndFrameSubscription();
 
+  // Encode the frame updates with a software video encoder.
+  void BeginFrameEncoding(gin::Arguments* args);
+  v8::Local<v8::Promise> EndFrameEncoding(v8::Isolate* isolate);
+
   // Dragging native items.
   void StartDrag(const gin_helper::Dictionary& item, gin::Arguments* args);
 
@@ -304,6 +308,9 @@ class WebContents final : public ExclusiveAccessContext,
   // done.
   v8::Local<v8::Promise> CapturePage(gin::Arguments* args);
 
+  // Same as CapturePage, but resolves with the encoded (or raw BGRA) pixels.
+  v8::Local<v8::Promise> CapturePageToBuffer(gin::Arguments* args);
+
   // Methods for creating <webview>.
   [[nodiscard]] bool is_guest() const { return type_ == Type::kWebView; }
   void AttachToIframe(content::WebContents* embedder_web_contents,
@@ -759,6 +766,8 @@ class WebContents final : public ExclusiveAccessContext,
                                  const std::string& file_system_path,
                                  const std::vector<std::string>& file_paths);
 
+  v8::Local<v8::Promise> CapturePageImpl(gin::Arguments* args, bool to_buffer);
+
   // Set fullscreen mode triggered by html api.
   void SetHtmlApiFullscreen(bool enter_fullscreen);
   // Update the html fullscreen flag in both browser and renderer.
@@ -770,6 +779,7 @@ class WebContents final : public ExclusiveAccessContext,
 
   std::unique_ptr<WebViewGuestDelegate> guest_delegate_;
   std::unique_ptr<FrameSubscriber> frame_subscriber_;
+  std::unique_ptr<FrameSubscriber> frame_encoding_subscriber_;
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   std::unique_ptr<extensions::ScriptExecutor> script_executor_;
@@ -4,13 +4,16 @@
 
 #include "shell/browser/api/electron_api_web_request.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
 
+#include "base/containers/adapters.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/memory/raw_ptr.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "extensions/browser/api/web_request/web_request_info.h"
@@ -20,6 +23,7 @@
 #include "gin/dictionary.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
+#include "net/http/http_util.h"
 #include "shell/browser/api/electron_api_session.h"
 #include "shell/browser/api/electron_api_web_contents.h"
 #include "shell/browser/api/electron_api_web_frame_main.h"
@@ -214,9 +218,12 @@ WebRequest::RequestFilter::RequestFilter(
     std::set<URLPattern> include_url_patterns,
     std::set<URLPattern> exclude_url_patterns,
     std::set<extensions::WebRequestResourceType> types)
-    : include_url_patterns_(std::move(include_url_patterns)),
-      exclude_url_patterns_(std::move(exclude_url_patterns)),
-      types_(std::move(types)) {}
+    : types_(std::move(types)) {
+  for (const auto& pattern : include_url_patterns)
+    include_url_patterns_.AddPattern(pattern);
+  for (const auto& pattern : exclude_url_patterns)
+    exclude_url_patterns_.AddPattern(pattern);
+}
 WebRequest::RequestFilter::RequestFilter(const RequestFilter&) = default;
 WebRequest::RequestFilter::RequestFilter() = default;
 WebRequest::RequestFilter::~RequestFilter() = default;
@@ -224,9 +231,9 @@ WebRequest::RequestFilter::~RequestFilter() = default;
 void WebRequest::RequestFilter::AddUrlPattern(URLPattern pattern,
                                               bool is_match_pattern) {
   if (is_match_pattern) {
-    include_url_patterns_.emplace(std::move(pattern));
+    include_url_patterns_.AddPattern(std::move(pattern));
   } else {
-    exclude_url_patterns_.emplace(std::move(pattern));
+    exclude_url_patterns_.AddPattern(std::move(pattern));
   }
 }
 
@@ -235,19 +242,6 @@ void WebRequest::RequestFilter::AddType(
   types_.insert(type);
 }
 
-bool WebRequest::RequestFilter::MatchesURL(
-    const GURL& url,
-    const std::set<URLPattern>& patterns) const {
-  if (patterns.empty())
-    return false;
-
-  for (const auto& pattern : patterns) {
-    if (pattern.MatchesURL(url))
-      return true;
-  }
-  return false;
-}
-
 bool WebRequest::RequestFilter::MatchesType(
     extensions::WebRequestResourceType type) const {
   return types_.empty() || types_.contains(type);
@@ -255,13 +249,14 @@ bool WebRequest::RequestFilter::MatchesType(
 
 bool WebRequest::RequestFilter::MatchesRequest(
     extensions::WebRequestInfo* info) const {
-  // Matches URL and type, and does not match exclude URL.
-  return MatchesURL(info->url, include_url_patterns_) &&
-         !MatchesURL(info->url, exclude_url_patterns_) &&
-         MatchesType(info->web_request_type);
+  // Matches type and URL, and does not match exclude URL. The type is the
+  // cheapest to check, so it goes first.
+  return MatchesType(info->web_request_type) &&
+         include_url_patterns_.MatchesURL(info->url) &&
+         !exclude_url_patterns_.MatchesURL(info->url);
 }
 
-void WebRequest::RequestFilter::AddUrlPatterns(
+bool WebRequest::RequestFilter::AddUrlPatterns(
     const std::set<std::string>& filter_patterns,
     RequestFilter* filter,
     gin::Arguments* args,
@@ -275,9 +270,10 @@ void WebRequest::RequestFilter::AddUrlPatterns(
       const char* error_type = URLPattern::GetParseResultString(result);
       args->ThrowTypeError("Invalid url pattern " + filter_pattern + ": " +
                            error_type);
-      return;
+      return false;
     }
   }
+  return true;
 }
 
 struct WebRequest::BlockedRequest {
@@ -288,6 +284,9 @@ struct WebRequest::BlockedRequest {
   BeforeSendHeadersCallback before_send_headers_callback;
   // Only used for onBeforeSendHeaders.
   raw_ptr<net::HttpRequestHeaders> request_headers = nullptr;
+  // Only used for onBeforeSendHeaders, set when rules modified the headers
+  // before the listener was called.
+  std::optional<net::HttpRequestHeaders> original_request_headers;
   // Only used for onHeadersReceived.
   scoped_refptr<const net::HttpResponseHeaders> original_response_headers;
   // Only used for onHeadersReceived.
@@ -298,6 +297,32 @@ struct WebRequest::BlockedRequest {
   raw_ptr<GURL> new_url = nullptr;
 };
 
+struct WebRequest::Rule {
+  enum class Action { kAllow, kBlock, kRedirect, kModifyHeaders };
+
+  struct HeaderOperation {
+    enum class Type { kSet, kAppend, kRemove };
+    Type type = Type::kSet;
+    std::string header;
+    std::string value;
+  };
+
+  int id = 0;
+  int priority = 1;
+  Action action = Action::kBlock;
+  RequestFilter condition;
+  // Only used for redirect rules, which either redirect to |redirect_url| or
+  // replace |redirect_from_prefix| at the start of the URL with
+  // |redirect_to_prefix|.
+  GURL redirect_url;
+  std::string redirect_from_prefix;
+  std::string redirect_to_prefix;
+  // Only used for modifyHeaders rules.
+  std::vector<HeaderOperation> request_headers;
+  std::vector<HeaderOperation> response_headers;
+  uint64_t hit_count = 0;
+};
+
 WebRequest::SimpleListenerInfo::SimpleListenerInfo(RequestFilter filter_,
                                                    SimpleListener listener_)
     : filter(std::move(filter_)), listener(listener_) {}
@@ -343,7 +368,9 @@ gin::ObjectTemplateBuilder WebRequest::GetObjectTemplateBuilder(
       .SetMethod("onErrorOccurred",
                  &WebRequest::SetSimpleListener<SimpleEvent::kOnErrorOccurred>)
       .SetMethod("onCompleted",
-                 &WebRequest::SetSimpleListener<SimpleEvent::kOnCompleted>);
+                 &WebRequest::SetSimpleListener<SimpleEvent::kOnCompleted>)
+      .SetMethod("setRules", &WebRequest::SetRules)
+      .SetMethod("getRuleHitCounts", &WebRequest::GetRuleHitCounts);
 }
 
 const char* WebRequest::GetTypeName() {
@@ -351,13 +378,17 @@ const char* WebRequest::GetTypeName() {
 }
 
 bool WebRequest::HasListener() const {
-  return !(simple_listeners_.empty() && response_listeners_.empty());
+  return !(simple_listeners_.empty() && response_listeners_.empty() &&
+           rules_.empty());
 }
 
 int WebRequest::OnBeforeRequest(extensions::WebRequestInfo* info,
                                 const network::ResourceRequest& request,
                                 net::CompletionOnceCallback callback,
                                 GURL* new_url) {
+  if (std::optional<int> result = ApplyBeforeRequestRules(info, new_url))
+    return *result;
+
   return HandleOnBeforeRequestResponseEvent(info, request, std::move(callback),
                                             new_url);
 }
@@ -423,15 +454,37 @@ int WebRequest::OnBeforeSendHeaders(extensions::WebRequestInfo* info,
                                     const network::ResourceRequest& request,
                                     BeforeSendHeadersCallback callback,
                                     net::HttpRequestHeaders* headers) {
-  return HandleOnBeforeSendHeadersResponseEvent(info, request,
-                                                std::move(callback), headers);
+  // Rules are applied first, the listener then sees the modified headers.
+  net::HttpRequestHeaders original_headers = *headers;
+  if (!ApplyRequestHeaderRules(info, headers)) {
+    return HandleOnBeforeSendHeadersResponseEvent(
+        info, request, std::move(callback), headers, std::nullopt);
+  }
+
+  const auto iter =
+      response_listeners_.find(ResponseEvent::kOnBeforeSendHeaders);
+  if (iter != std::end(response_listeners_) &&
+      iter->second.filter.MatchesRequest(info)) {
+    return HandleOnBeforeSendHeadersResponseEvent(
+        info, request, std::move(callback), headers,
+        std::move(original_headers));
+  }
+
+  // Report the changes the same way a listener's response would be.
+  const auto [modified_headers, deleted_headers] =
+      CalculateOnBeforeSendHeadersDelta(&original_headers, headers);
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(std::move(callback), deleted_headers,
+                                modified_headers, net::OK));
+  return net::ERR_IO_PENDING;
 }
 
 int WebRequest::HandleOnBeforeSendHeadersResponseEvent(
     extensions::WebRequestInfo* request_info,
     const network::ResourceRequest& request,
     BeforeSendHeadersCallback callback,
-    net::HttpRequestHeaders* headers) {
+    net::HttpRequestHeaders* headers,
+    std::optional<net::HttpRequestHeaders> original_headers) {
   const auto iter =
       response_listeners_.find(ResponseEvent::kOnBeforeSendHeaders);
   if (iter == std::end(response_listeners_))
@@ -444,6 +497,7 @@ int WebRequest::HandleOnBeforeSendHeadersResponseEvent(
   BlockedRequest blocked_request;
   blocked_request.before_send_headers_callback = std::move(callback);
   blocked_request.request_headers = headers;
+  blocked_request.original_request_headers = std::move(original_headers);
   blocked_requests_[request_info->id] = std::move(blocked_request);
 
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
@@ -490,6 +544,14 @@ void WebRequest::OnBeforeSendHeadersListenerResult(
     }
   }
 
+  // When rules already modified the headers, report their changes too, and
+  // keep them if the user didn't modify the headers.
+  if (request.original_request_headers) {
+    if (!user_modified_headers)
+      new_headers = *old_headers;
+    old_headers = &*request.original_request_headers;
+  }
+
   // If the user passes |cancel|, |new_headers| should be nullptr.
   const auto updated_headers = CalculateOnBeforeSendHeadersDelta(
       old_headers,
@@ -513,6 +575,10 @@ int WebRequest::OnHeadersReceived(
     const net::HttpResponseHeaders* original_response_headers,
     scoped_refptr<net::HttpResponseHeaders>* override_response_headers,
     GURL* allowed_unsafe_redirect_url) {
+  // Rules are applied first, the listener then sees the modified headers.
+  ApplyResponseHeaderRules(info, original_response_headers,
+                           override_response_headers);
+
   return HandleOnHeadersReceivedResponseEvent(
       info, request, std::move(callback), original_response_headers,
       override_response_headers);
@@ -532,18 +598,26 @@ int WebRequest::HandleOnHeadersReceivedResponseEvent(
   if (!info.filter.MatchesRequest(request_info))
     return net::OK;
 
+  // The headers as modified by the rules, if any of them applied.
+  const net::HttpResponseHeaders* response_headers =
+      *override_response_headers ? override_response_headers->get()
+                                 : original_response_headers;
+
   BlockedRequest blocked_request;
   blocked_request.callback = std::move(callback);
   blocked_request.override_response_headers = override_response_headers;
-  blocked_request.status_line = original_response_headers
-                                    ? original_response_headers->GetStatusLine()
-                                    : std::string();
+  blocked_request.status_line =
+      response_headers ? response_headers->GetStatusLine() : std::string();
   blocked_requests_[request_info->id] = std::move(blocked_request);
 
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
   gin_helper::Dictionary details(isolate, v8::Object::New(isolate));
   FillDetails(&details, request_info, request);
+  if (*override_response_headers) {
+    details.Set("responseHeaders",
+                HttpResponseHeadersToV8(override_response_headers->get()));
+  }
 
   ResponseCallback response =
       base::BindOnce(&WebRequest::OnHeadersReceivedListenerResult,
@@ -633,6 +707,282 @@ void WebRequest::OnRequestWillBeDestroyed(extensions::WebRequestInfo* info) {
   blocked_requests_.erase(info->id);
 }
 
+void WebRequest::SetRules(gin::Arguments* args) {
+  std::vector<v8::Local<v8::Value>> values;
+  if (!args->GetNext(&values)) {
+    args->ThrowTypeError("Must pass an array of rules");
+    return;
+  }
+
+  std::vector<Rule> rules(values.size());
+  std::set<int> ids;
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (!ParseRule(args, values[i], &rules[i]))
+      return;
+    if (!ids.insert(rules[i].id).second) {
+      args->ThrowTypeError("Duplicate rule id " +
+                           base::NumberToString(rules[i].id));
+      return;
+    }
+  }
+
+  // Higher priorities first. Among rules of the same priority, allow rules
+  // win over block rules, which win over redirect rules.
+  std::ranges::stable_sort(rules, [](const Rule& a, const Rule& b) {
+    if (a.priority != b.priority)
+      return a.priority > b.priority;
+    return a.action < b.action;
+  });
+  rules_ = std::move(rules);
+}
+
+v8::Local<v8::Value> WebRequest::GetRuleHitCounts(v8::Isolate* isolate) const {
+  std::map<int, uint64_t> hit_counts;
+  for (const auto& rule : rules_)
+    hit_counts[rule.id] = rule.hit_count;
+
+  base::Value::List list;
+  for (const auto& [id, hits] : hit_counts) {
+    list.Append(base::Value::Dict().Set("id", id).Set(
+        "hits", static_cast<double>(hits)));
+  }
+  return gin::ConvertToV8(isolate, list);
+}
+
+bool WebRequest::ParseRule(gin::Arguments* args,
+                           v8::Local<v8::Value> value,
+                           Rule* rule) {
+  static constexpr auto kActions =
+      base::MakeFixedFlatMap<std::string_view, Rule::Action>({
+          {"allow", Rule::Action::kAllow},
+          {"block", Rule::Action::kBlock},
+          {"modifyHeaders", Rule::Action::kModifyHeaders},
+          {"redirect", Rule::Action::kRedirect},
+      });
+  static constexpr auto kOperations =
+      base::MakeFixedFlatMap<std::string_view, Rule::HeaderOperation::Type>({
+          {"append", Rule::HeaderOperation::Type::kAppend},
+          {"remove", Rule::HeaderOperation::Type::kRemove},
+          {"set", Rule::HeaderOperation::Type::kSet},
+      });
+
+  v8::Isolate* isolate = args->isolate();
+  gin::Dictionary dict(isolate);
+  if (!gin::ConvertFromV8(isolate, value, &dict) ||
+      !dict.Get("id", &rule->id)) {
+    args->ThrowTypeError("Each rule must be an object with an integer 'id'");
+    return false;
+  }
+  dict.Get("priority", &rule->priority);
+  const std::string name = "Rule " + base::NumberToString(rule->id);
+
+  gin::Dictionary action(isolate);
+  std::string action_type;
+  if (!dict.Get("action", &action) || !action.Get("type", &action_type)) {
+    args->ThrowTypeError(name + " must have an 'action' with a 'type'");
+    return false;
+  }
+  if (!kActions.contains(action_type)) {
+    args->ThrowTypeError(name + " has an unknown action type '" +
+                         action_type +
+                         "', expected one of allow, block, modifyHeaders or "
+                         "redirect");
+    return false;
+  }
+  rule->action = kActions.at(action_type);
+
+  // The condition has the same shape as the filter of the listeners.
+  std::set<std::string> urls, exclude_urls, types;
+  gin::Dictionary condition(isolate);
+  if (dict.Get("condition", &condition)) {
+    condition.Get("urls", &urls);
+    condition.Get("excludeUrls", &exclude_urls);
+    condition.Get("types", &types);
+  }
+  if (urls.empty())
+    urls.insert("<all_urls>");
+  if (!rule->condition.AddUrlPatterns(urls, &rule->condition, args) ||
+      !rule->condition.AddUrlPatterns(exclude_urls, &rule->condition, args,
+                                      false)) {
+    return false;
+  }
+  for (const std::string& type : types) {
+    auto resource_type = ParseResourceType(type);
+    if (resource_type == extensions::WebRequestResourceType::OTHER) {
+      args->ThrowTypeError("Invalid type " + type);
+      return false;
+    }
+    rule->condition.AddType(resource_type);
+  }
+
+  if (rule->action == Rule::Action::kRedirect) {
+    gin::Dictionary redirect(isolate);
+    const bool valid =
+        action.Get("redirect", &redirect) &&
+        (redirect.Get("url", &rule->redirect_url)
+             ? rule->redirect_url.is_valid()
+             : redirect.Get("fromPrefix", &rule->redirect_from_prefix) &&
+                   !rule->redirect_from_prefix.empty() &&
+                   redirect.Get("toPrefix", &rule->redirect_to_prefix));
+    if (!valid) {
+      args->ThrowTypeError(name +
+                           " must have a 'redirect' with either a valid 'url' "
+                           "or 'fromPrefix' and 'toPrefix'");
+      return false;
+    }
+  }
+
+  std::optional<std::string> unknown_operation;
+  auto parse_operations =
+      [&](const char* key, std::vector<Rule::HeaderOperation>* operations) {
+        v8::Local<v8::Value> list;
+        if (!action.Get(key, &list) || list->IsUndefined())
+          return true;
+        std::vector<v8::Local<v8::Object>> objects;
+        if (!gin::ConvertFromV8(isolate, list, &objects))
+          return false;
+        for (v8::Local<v8::Object> object : objects) {
+          gin::Dictionary operation_dict(isolate, object);
+          Rule::HeaderOperation operation;
+          std::string type;
+          if (!operation_dict.Get("header", &operation.header) ||
+              !net::HttpUtil::IsValidHeaderName(operation.header) ||
+              !operation_dict.Get("operation", &type)) {
+            return false;
+          }
+          if (!kOperations.contains(type)) {
+            unknown_operation = type;
+            return false;
+          }
+          operation.type = kOperations.at(type);
+          if (operation.type != Rule::HeaderOperation::Type::kRemove &&
+              (!operation_dict.Get("value", &operation.value) ||
+               !net::HttpUtil::IsValidHeaderValue(operation.value))) {
+            return false;
+          }
+          operations->push_back(std::move(operation));
+        }
+        return true;
+      };
+  if (rule->action == Rule::Action::kModifyHeaders &&
+      (!parse_operations("requestHeaders", &rule->request_headers) ||
+       !parse_operations("responseHeaders", &rule->response_headers) ||
+       (rule->request_headers.empty() && rule->response_headers.empty()))) {
+    if (unknown_operation) {
+      args->ThrowTypeError(name + " has an unknown header operation '" +
+                           *unknown_operation +
+                           "', expected one of append, remove or set");
+      return false;
+    }
+    args->ThrowTypeError(name +
+                         " must have valid 'requestHeaders' or "
+                         "'responseHeaders'");
+    return false;
+  }
+
+  return true;
+}
+
+std::optional<int> WebRequest::ApplyBeforeRequestRules(
+    extensions::WebRequestInfo* info,
+    GURL* new_url) {
+  for (auto& rule : rules_) {
+    if (rule.action == Rule::Action::kModifyHeaders ||
+        !rule.condition.MatchesRequest(info))
+      continue;
+
+    if (rule.action == Rule::Action::kRedirect) {
+      GURL url = rule.redirect_url;
+      if (!rule.redirect_from_prefix.empty()) {
+        const std::string& spec = info->url.spec();
+        if (!spec.starts_with(rule.redirect_from_prefix))
+          continue;
+        url = GURL(rule.redirect_to_prefix +
+                   spec.substr(rule.redirect_from_prefix.size()));
+      }
+      if (!url.is_valid() || url == info->url)
+        continue;
+      *new_url = std::move(url);
+    }
+
+    ++rule.hit_count;
+    return rule.action == Rule::Action::kBlock ? net::ERR_BLOCKED_BY_CLIENT
+                                               : net::OK;
+  }
+  return std::nullopt;
+}
+
+bool WebRequest::ApplyRequestHeaderRules(extensions::WebRequestInfo* info,
+                                         net::HttpRequestHeaders* headers) {
+  bool applied = false;
+  // Lower priorities go first, so that higher ones take precedence.
+  for (auto& rule : base::Reversed(rules_)) {
+    if (rule.request_headers.empty() || !rule.condition.MatchesRequest(info))
+      continue;
+
+    for (const auto& operation : rule.request_headers) {
+      switch (operation.type) {
+        case Rule::HeaderOperation::Type::kSet:
+          headers->SetHeader(operation.header, operation.value);
+          break;
+        case Rule::HeaderOperation::Type::kAppend: {
+          std::optional<std::string> current =
+              headers->GetHeader(operation.header);
+          headers->SetHeader(operation.header,
+                             current ? *current + ", " + operation.value
+                                     : operation.value);
+          break;
+        }
+        case Rule::HeaderOperation::Type::kRemove:
+          headers->RemoveHeader(operation.header);
+          break;
+      }
+    }
+    ++rule.hit_count;
+    applied = true;
+  }
+  return applied;
+}
+
+bool WebRequest::ApplyResponseHeaderRules(
+    extensions::WebRequestInfo* info,
+    const net::HttpResponseHeaders* original_response_headers,
+    scoped_refptr<net::HttpResponseHeaders>* override_response_headers) {
+  if (!original_response_headers)
+    return false;
+
+  scoped_refptr<net::HttpResponseHeaders> headers;
+  // Lower priorities go first, so that higher ones take precedence.
+  for (auto& rule : base::Reversed(rules_)) {
+    if (rule.response_headers.empty() || !rule.condition.MatchesRequest(info))
+      continue;
+
+    if (!headers) {
+      headers = base::MakeRefCounted<net::HttpResponseHeaders>(
+          original_response_headers->raw_headers());
+    }
+    for (const auto& operation : rule.response_headers) {
+      switch (operation.type) {
+        case Rule::HeaderOperation::Type::kSet:
+          headers->SetHeader(operation.header, operation.value);
+          break;
+        case Rule::HeaderOperation::Type::kAppend:
+          headers->AddHeader(operation.header, operation.value);
+          break;
+        case Rule::HeaderOperation::Type::kRemove:
+          headers->RemoveHeader(operation.header);
+          break;
+      }
+    }
+    ++rule.hit_count;
+  }
+
+  if (!headers)
+    return false;
+  *override_response_headers = std::move(headers);
+  return true;
+}
+
 template <WebRequest::SimpleEvent event>
 void WebRequest::SetSimpleListener(gin::Arguments* args) {
   SetListener<SimpleListener>(event, &simple_listeners_, args);
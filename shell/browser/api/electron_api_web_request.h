@@ -6,10 +6,13 @@
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_WEB_REQUEST_H_
 
 #include <map>
+#include <optional>
 #include <set>
+#include <vector>
 
 #include "base/memory/raw_ptr.h"
 #include "gin/wrappable.h"
+#include "shell/browser/net/url_pattern_matcher.h"
 #include "shell/browser/net/web_request_api_interface.h"
 
 class URLPattern;
@@ -100,6 +103,9 @@ class WebRequest final : public gin::Wrappable<WebRequest>,
   // the user.
   struct BlockedRequest;
 
+  // A rule set with setRules(), which is evaluated without calling into JS.
+  struct Rule;
+
   enum class SimpleEvent {
     kOnSendHeaders,
     kOnBeforeRedirect,
@@ -126,6 +132,21 @@ class WebRequest final : public gin::Wrappable<WebRequest>,
   template <typename Listener, typename Listeners, typename Event>
   void SetListener(Event event, Listeners* listeners, gin::Arguments* args);
 
+  void SetRules(gin::Arguments* args);
+  v8::Local<v8::Value> GetRuleHitCounts(v8::Isolate* isolate) const;
+  bool ParseRule(gin::Arguments* args, v8::Local<v8::Value> value, Rule* rule);
+
+  // Apply the rules to a request. These return std::nullopt or false when no
+  // rule resolved the request, in which case the JS listener is called.
+  std::optional<int> ApplyBeforeRequestRules(extensions::WebRequestInfo* info,
+                                             GURL* new_url);
+  bool ApplyRequestHeaderRules(extensions::WebRequestInfo* info,
+                               net::HttpRequestHeaders* headers);
+  bool ApplyResponseHeaderRules(
+      extensions::WebRequestInfo* info,
+      const net::HttpResponseHeaders* original_response_headers,
+      scoped_refptr<net::HttpResponseHeaders>* override_response_headers);
+
   template <typename... Args>
   void HandleSimpleEvent(SimpleEvent event,
                          extensions::WebRequestInfo* info,
@@ -140,7 +161,8 @@ class WebRequest final : public gin::Wrappable<WebRequest>,
       extensions::WebRequestInfo* info,
       const network::ResourceRequest& request,
       BeforeSendHeadersCallback callback,
-      net::HttpRequestHeaders* headers);
+      net::HttpRequestHeaders* headers,
+      std::optional<net::HttpRequestHeaders> original_headers);
   int HandleOnHeadersReceivedResponseEvent(
       extensions::WebRequestInfo* info,
       const network::ResourceRequest& request,
@@ -165,7 +187,7 @@ class WebRequest final : public gin::Wrappable<WebRequest>,
     ~RequestFilter();
 
     void AddUrlPattern(URLPattern pattern, bool is_match_pattern);
-    void AddUrlPatterns(const std::set<std::string>& filter_patterns,
+    bool AddUrlPatterns(const std::set<std::string>& filter_patterns,
                         RequestFilter* filter,
                         gin::Arguments* args,
                         bool is_match_pattern = true);
@@ -174,12 +196,12 @@ class WebRequest final : public gin::Wrappable<WebRequest>,
     bool MatchesRequest(extensions::WebRequestInfo* info) const;
 
    private:
-    bool MatchesURL(const GURL& url,
-                    const std::set<URLPattern>& patterns) const;
     bool MatchesType(extensions::WebRequestResourceType type) const;
 
-    std::set<URLPattern> include_url_patterns_;
-    std::set<URLPattern> exclude_url_patterns_;
+    // Indexed when the listener is set, since they are matched against every
+    // request.
+    URLPatternMatcher include_url_patterns_;
+    URLPatternMatcher exclude_url_patterns_;
     std::set<extensions::WebRequestResourceType> types_;
   };
 
@@ -204,6 +226,8 @@ class WebRequest final : public gin::Wrappable<WebRequest>,
   std::map<SimpleEvent, SimpleListenerInfo> simple_listeners_;
   std::map<ResponseEvent, ResponseListenerInfo> response_listeners_;
   std::map<uint64_t, BlockedRequest> blocked_requests_;
+  // Sorted by the order in which they are evaluated.
+  std::vector<Rule> rules_;
 
   // Weak-ref, it manages us.
   raw_ptr<content::BrowserContext> browser_context_;
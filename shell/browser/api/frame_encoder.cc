@@ -0,0 +1,343 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/frame_encoder.h"
+
+#include <array>
+#include <memory>
+#include <utility>
+
+#include "base/compiler_specific.h"
+#include "base/containers/span.h"
+#include "base/containers/span_writer.h"
+#include "base/files/file.h"
+#include "base/functional/bind.h"
+#include "base/logging.h"
+#include "base/task/bind_post_task.h"
+#include "base/task/thread_pool.h"
+#include "gin/array_buffer.h"
+#include "media/base/bitrate.h"
+#include "media/base/video_codecs.h"
+#include "media/base/video_encoder.h"
+#include "media/base/video_frame.h"
+#include "media/media_buildflags.h"
+
+#if BUILDFLAG(ENABLE_LIBVPX)
+#include "media/video/vpx_video_encoder.h"
+#endif
+
+#if BUILDFLAG(ENABLE_OPENH264)
+#include "media/video/openh264_video_encoder.h"
+#endif
+
+namespace electron::api {
+
+namespace {
+
+// https://wiki.multimedia.cx/index.php/Duck_IVF
+constexpr size_t kIvfFileHeaderSize = 32;
+constexpr size_t kIvfFrameHeaderSize = 12;
+constexpr int64_t kIvfFrameCountOffset = 24;
+
+// Timestamps are written in microseconds.
+constexpr uint32_t kIvfTimebaseDenominator = 1'000'000;
+
+std::unique_ptr<media::VideoEncoder> CreateVideoEncoder(
+    FrameEncoder::Codec codec) {
+  switch (codec) {
+#if BUILDFLAG(ENABLE_LIBVPX)
+    case FrameEncoder::Codec::kVP8:
+    case FrameEncoder::Codec::kVP9:
+      return std::make_unique<media::VpxVideoEncoder>();
+#endif
+#if BUILDFLAG(ENABLE_OPENH264)
+    case FrameEncoder::Codec::kH264:
+      return std::make_unique<media::OpenH264VideoEncoder>();
+#endif
+    default:
+      return nullptr;
+  }
+}
+
+media::VideoCodecProfile GetCodecProfile(FrameEncoder::Codec codec) {
+  switch (codec) {
+    case FrameEncoder::Codec::kVP8:
+      return media::VP8PROFILE_ANY;
+    case FrameEncoder::Codec::kVP9:
+      return media::VP9PROFILE_PROFILE0;
+    case FrameEncoder::Codec::kH264:
+      return media::H264PROFILE_BASELINE;
+  }
+}
+
+// Copies |data| into memory from the allocator of the ArrayBuffers, which is
+// thread safe and the only memory V8 can adopt when its sandbox is enabled.
+// This leaves the UI thread with nothing to copy.
+std::unique_ptr<v8::BackingStore> CopyToBackingStore(
+    base::span<const uint8_t> data) {
+  void* buffer =
+      gin::ArrayBufferAllocator::SharedInstance()->AllocateUninitialized(
+          data.size());
+  if (!buffer)
+    return nullptr;
+  // SAFETY: |buffer| was just allocated with |data.size()| bytes.
+  UNSAFE_BUFFERS(base::span(static_cast<uint8_t*>(buffer), data.size()))
+      .copy_from(data);
+  return v8::ArrayBuffer::NewBackingStore(
+      buffer, data.size(),
+      [](void* memory, size_t length, void*) {
+        gin::ArrayBufferAllocator::SharedInstance()->Free(memory, length);
+      },
+      nullptr);
+}
+
+}  // namespace
+
+// Lives on a thread pool sequence and owns the encoder and the output file.
+class FrameEncoder::Core {
+ public:
+  Core(const Options& options,
+       ChunkCallback chunk_callback,
+       base::RepeatingCallback<void(std::string)> error_callback)
+      : options_(options),
+        chunk_callback_(std::move(chunk_callback)),
+        error_callback_(std::move(error_callback)) {
+    if (!options_.path.empty()) {
+      file_.Initialize(options_.path, base::File::FLAG_CREATE_ALWAYS |
+                                          base::File::FLAG_WRITE);
+      if (!file_.IsValid()) {
+        ReportError("Failed to open " + options_.path.AsUTF8Unsafe() + ": " +
+                    base::File::ErrorToString(file_.error_details()));
+      }
+    }
+  }
+
+  // Patches the IVF header when the encoder is destroyed without being
+  // flushed, e.g. along with its WebContents.
+  ~Core() { CloseFile(); }
+
+  // disable copy
+  Core(const Core&) = delete;
+  Core& operator=(const Core&) = delete;
+
+  void Encode(scoped_refptr<media::VideoFrame> frame) {
+    if (failed_)
+      return;
+
+    const gfx::Size size = frame->visible_rect().size();
+    if (!encoder_) {
+      if (!InitializeEncoder(size))
+        return;
+    } else if (size != frame_size_) {
+      // The stream, and the IVF header, keep the size of the first frame.
+      // FrameSubscriber letterboxes the view into it, so this is unexpected.
+      DLOG(WARNING) << "Dropping frame of size " << size.ToString();
+      return;
+    }
+
+    // Force keyframes ourselves so the interval is the same for every
+    // encoder implementation.
+    const bool key_frame =
+        frames_since_keyframe_ == 0 ||
+        frames_since_keyframe_ >= options_.keyframe_interval;
+    frames_since_keyframe_ = key_frame ? 1 : frames_since_keyframe_ + 1;
+
+    encoder_->Encode(std::move(frame),
+                     media::VideoEncoder::EncodeOptions(key_frame),
+                     base::BindOnce(&Core::OnEncoderStatus,
+                                    weak_ptr_factory_.GetWeakPtr()));
+  }
+
+  void Flush(base::OnceClosure done) {
+    if (!encoder_ || failed_) {
+      CloseFile();
+      std::move(done).Run();
+      return;
+    }
+    encoder_->Flush(base::BindOnce(&Core::OnFlushed,
+                                   weak_ptr_factory_.GetWeakPtr(),
+                                   std::move(done)));
+  }
+
+ private:
+  bool InitializeEncoder(const gfx::Size& size) {
+    encoder_ = CreateVideoEncoder(options_.codec);
+    if (!encoder_) {
+      ReportError("Unsupported codec");
+      return false;
+    }
+
+    frame_size_ = size;
+    frames_since_keyframe_ = 0;
+
+    media::VideoEncoder::Options options;
+    options.frame_size = size;
+    options.framerate = options_.frame_rate;
+    options.bitrate = media::Bitrate::ConstantBitrate(options_.bitrate);
+    options.keyframe_interval = options_.keyframe_interval;
+    options.latency_mode = media::VideoEncoder::LatencyMode::Realtime;
+    if (options_.codec == Codec::kH264)
+      options.avc.produce_annexb = true;
+
+    encoder_->Initialize(
+        GetCodecProfile(options_.codec), options, base::DoNothing(),
+        base::BindRepeating(&Core::OnEncodedOutput,
+                            weak_ptr_factory_.GetWeakPtr()),
+        base::BindOnce(&Core::OnEncoderStatus,
+                       weak_ptr_factory_.GetWeakPtr()));
+
+    if (file_.IsValid() && !wrote_file_header_ &&
+        options_.codec != Codec::kH264) {
+      WriteIvfFileHeader(size);
+    }
+    return !failed_;
+  }
+
+  void OnEncodedOutput(
+      media::VideoEncoderOutput output,
+      std::optional<media::VideoEncoder::CodecDescription> description) {
+    if (failed_ || output.data.empty())
+      return;
+
+    if (!file_.IsValid()) {
+      std::unique_ptr<v8::BackingStore> data =
+          CopyToBackingStore(output.data);
+      if (!data) {
+        ReportError("Failed to allocate an encoded chunk");
+        return;
+      }
+      chunk_callback_.Run(std::move(data), output.key_frame, output.timestamp);
+      return;
+    }
+
+    if (options_.codec != Codec::kH264) {
+      std::array<uint8_t, kIvfFrameHeaderSize> header;
+      auto writer = base::SpanWriter(base::span(header));
+      writer.WriteU32LittleEndian(output.data.size());
+      writer.WriteU64LittleEndian(output.timestamp.InMicroseconds());
+      if (!WriteToFile(header))
+        return;
+      ++frames_written_;
+    }
+    WriteToFile(output.data);
+  }
+
+  void OnEncoderStatus(media::EncoderStatus status) {
+    if (!status.is_ok())
+      ReportError(status.message());
+  }
+
+  void OnFlushed(base::OnceClosure done, media::EncoderStatus status) {
+    OnEncoderStatus(std::move(status));
+    CloseFile();
+    std::move(done).Run();
+  }
+
+  void WriteIvfFileHeader(const gfx::Size& size) {
+    std::array<uint8_t, kIvfFileHeaderSize> header = {};
+    auto writer = base::SpanWriter(base::span(header));
+    writer.Write(base::byte_span_from_cstring("DKIF"));
+    writer.WriteU16LittleEndian(0);  // version
+    writer.WriteU16LittleEndian(kIvfFileHeaderSize);
+    writer.Write(base::byte_span_from_cstring(
+        options_.codec == Codec::kVP9 ? "VP90" : "VP80"));
+    writer.WriteU16LittleEndian(size.width());
+    writer.WriteU16LittleEndian(size.height());
+    writer.WriteU32LittleEndian(kIvfTimebaseDenominator);
+    writer.WriteU32LittleEndian(1);  // timebase numerator
+    // The frame count and the unused field are left zeroed; the former is
+    // patched in CloseFile().
+    wrote_file_header_ = WriteToFile(header);
+  }
+
+  bool WriteToFile(base::span<const uint8_t> data) {
+    if (!file_.WriteAtCurrentPosAndCheck(data)) {
+      ReportError("Failed to write encoded frame to " +
+                  options_.path.AsUTF8Unsafe());
+      return false;
+    }
+    return true;
+  }
+
+  void CloseFile() {
+    if (!file_.IsValid())
+      return;
+    if (wrote_file_header_) {
+      std::array<uint8_t, 4> count;
+      base::SpanWriter(base::span(count))
+          .WriteU32LittleEndian(frames_written_);
+      file_.Write(kIvfFrameCountOffset, count);
+    }
+    file_.Close();
+  }
+
+  void ReportError(std::string error) {
+    if (failed_)
+      return;
+    failed_ = true;
+    LOG(ERROR) << "Frame encoding failed: " << error;
+    error_callback_.Run(std::move(error));
+  }
+
+  const Options options_;
+  ChunkCallback chunk_callback_;
+  base::RepeatingCallback<void(std::string)> error_callback_;
+
+  std::unique_ptr<media::VideoEncoder> encoder_;
+  gfx::Size frame_size_;
+  int frames_since_keyframe_ = 0;
+  bool failed_ = false;
+
+  base::File file_;
+  bool wrote_file_header_ = false;
+  uint32_t frames_written_ = 0;
+
+  base::WeakPtrFactory<Core> weak_ptr_factory_{this};
+};
+
+// static
+bool FrameEncoder::IsCodecSupported(Codec codec) {
+  switch (codec) {
+    case Codec::kVP8:
+    case Codec::kVP9:
+      return BUILDFLAG(ENABLE_LIBVPX);
+    case Codec::kH264:
+      return BUILDFLAG(ENABLE_OPENH264);
+  }
+}
+
+FrameEncoder::FrameEncoder(const Options& options, ChunkCallback chunk_callback)
+    : options_(options) {
+  core_ = base::SequenceBound<Core>(
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}),
+      options, base::BindPostTaskToCurrentDefault(std::move(chunk_callback)),
+      base::BindPostTaskToCurrentDefault(base::BindRepeating(
+          &FrameEncoder::OnError, weak_ptr_factory_.GetWeakPtr())));
+}
+
+FrameEncoder::~FrameEncoder() = default;
+
+void FrameEncoder::EncodeFrame(scoped_refptr<media::VideoFrame> frame) {
+  if (error_)
+    return;
+  core_.AsyncCall(&Core::Encode).WithArgs(std::move(frame));
+}
+
+void FrameEncoder::Flush(DoneCallback callback) {
+  core_.AsyncCall(&Core::Flush)
+      .WithArgs(base::BindPostTaskToCurrentDefault(base::BindOnce(
+          [](base::WeakPtr<FrameEncoder> self, DoneCallback callback) {
+            std::move(callback).Run(self ? self->error_ : std::nullopt);
+          },
+          weak_ptr_factory_.GetWeakPtr(), std::move(callback))));
+}
+
+void FrameEncoder::OnError(std::string error) {
+  if (!error_)
+    error_ = std::move(error);
+}
+
+}  // namespace electron::api
@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_FRAME_ENCODER_H_
+#define ELECTRON_SHELL_BROWSER_API_FRAME_ENCODER_H_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/threading/sequence_bound.h"
+#include "base/time/time.h"
+#include "v8/include/v8-array-buffer.h"
+
+namespace media {
+class VideoFrame;
+}  // namespace media
+
+namespace electron::api {
+
+// Feeds captured frames into a software video encoder (libvpx or OpenH264)
+// running on a thread pool sequence, so no GPU is required. Encoded chunks are
+// either appended to a file on that same sequence or handed back to the
+// sequence the encoder was created on, already copied into memory that V8
+// can adopt as the backing store of an ArrayBuffer.
+class FrameEncoder {
+ public:
+  enum class Codec { kVP8, kVP9, kH264 };
+
+  struct Options {
+    Codec codec = Codec::kVP8;
+    // Target bitrate in bits per second.
+    uint32_t bitrate = 2'500'000;
+    // Number of frames between two forced keyframes.
+    int keyframe_interval = 60;
+    int frame_rate = 30;
+    // When set, VP8/VP9 output is written as IVF and H.264 as an Annex B
+    // elementary stream instead of being passed to the chunk callback.
+    base::FilePath path;
+  };
+
+  using ChunkCallback =
+      base::RepeatingCallback<void(std::unique_ptr<v8::BackingStore> data,
+                                   bool key_frame,
+                                   base::TimeDelta timestamp)>;
+  using DoneCallback =
+      base::OnceCallback<void(std::optional<std::string> error)>;
+
+  static bool IsCodecSupported(Codec codec);
+
+  FrameEncoder(const Options& options, ChunkCallback chunk_callback);
+  ~FrameEncoder();
+
+  // disable copy
+  FrameEncoder(const FrameEncoder&) = delete;
+  FrameEncoder& operator=(const FrameEncoder&) = delete;
+
+  const Options& options() const { return options_; }
+
+  // |frame| must stay valid until it is released by the encoder sequence.
+  void EncodeFrame(scoped_refptr<media::VideoFrame> frame);
+
+  // Drains the encoder and closes the output file. |callback| receives the
+  // first error reported by the encoder, if any.
+  void Flush(DoneCallback callback);
+
+ private:
+  class Core;
+
+  void OnError(std::string error);
+
+  const Options options_;
+  std::optional<std::string> error_;
+
+  base::SequenceBound<Core> core_;
+
+  base::WeakPtrFactory<FrameEncoder> weak_ptr_factory_{this};
+};
+
+}  // namespace electron::api
+
+#endif  // ELECTRON_SHELL_BROWSER_API_FRAME_ENCODER_H_
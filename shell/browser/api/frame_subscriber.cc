@@ -10,10 +10,12 @@
 #include "content/public/browser/render_widget_host.h"
 #include "content/public/browser/render_widget_host_view.h"
 #include "content/public/browser/web_contents.h"
+#include "media/base/video_frame.h"
 #include "media/capture/mojom/video_capture_buffer.mojom.h"
 #include "media/capture/mojom/video_capture_types.mojom.h"
 #include "mojo/public/cpp/bindings/remote.h"
 #include "services/viz/privileged/mojom/compositing/frame_sink_video_capture.mojom-shared.h"
+#include "shell/browser/api/frame_encoder.h"
 #include "ui/gfx/geometry/size_conversions.h"
 #include "ui/gfx/image/image.h"
 #include "ui/gfx/skbitmap_operations.h"
@@ -31,8 +33,20 @@ FrameSubscriber::FrameSubscriber(content::WebContents* web_contents,
   AttachToHost(web_contents->GetPrimaryMainFrame()->GetRenderWidgetHost());
 }
 
+FrameSubscriber::FrameSubscriber(content::WebContents* web_contents,
+                                 std::unique_ptr<FrameEncoder> encoder)
+    : content::WebContentsObserver(web_contents),
+      encoder_(std::move(encoder)) {
+  AttachToHost(web_contents->GetPrimaryMainFrame()->GetRenderWidgetHost());
+}
+
 FrameSubscriber::~FrameSubscriber() = default;
 
+std::unique_ptr<FrameEncoder> FrameSubscriber::TakeEncoder() {
+  DetachFromHost();
+  return std::move(encoder_);
+}
+
 void FrameSubscriber::AttachToHost(content::RenderWidgetHost* host) {
   host_ = host;
 
@@ -45,12 +59,24 @@ void FrameSubscriber::AttachToHost(content::RenderWidgetHost* host) {
   // Create and configure the video capturer.
   gfx::Size size = GetRenderViewSize();
   DCHECK(!size.IsEmpty());
+  // An encoded stream can't change its size, so later views are letterboxed
+  // into the size of the first one.
+  if (encoder_) {
+    if (encoded_size_.IsEmpty())
+      encoded_size_ = size;
+    size = encoded_size_;
+  }
   video_capturer_ = rwhv->CreateVideoCapturer();
   video_capturer_->SetResolutionConstraints(size, size, true);
   video_capturer_->SetAutoThrottlingEnabled(false);
   video_capturer_->SetMinSizeChangePeriod(base::TimeDelta());
-  video_capturer_->SetFormat(media::PIXEL_FORMAT_ARGB);
-  video_capturer_->SetMinCapturePeriod(base::Seconds(1) / kMaxFrameRate);
+  // Software encoders consume I420 directly, which spares a conversion on the
+  // encoder sequence.
+  video_capturer_->SetFormat(encoder_ ? media::PIXEL_FORMAT_I420
+                                      : media::PIXEL_FORMAT_ARGB);
+  video_capturer_->SetMinCapturePeriod(
+      base::Seconds(1) /
+      (encoder_ ? encoder_->options().frame_rate : kMaxFrameRate));
   video_capturer_->Start(this, viz::mojom::BufferFormatPreference::kDefault);
 }
 
@@ -90,7 +116,7 @@ void FrameSubscriber::OnFrameCaptured(
   auto& data_region = data->get_read_only_shmem_region();
 
   gfx::Size size = GetRenderViewSize();
-  if (size != content_rect.size()) {
+  if (!encoder_ && size != content_rect.size()) {
     video_capturer_->SetResolutionConstraints(size, size, true);
     video_capturer_->RequestRefreshFrame();
     return;
@@ -113,6 +139,11 @@ void FrameSubscriber::OnFrameCaptured(
     return;
   }
 
+  if (encoder_) {
+    EncodeFrame(std::move(mapping), *info, callbacks_remote.Unbind());
+    return;
+  }
+
   // The SkBitmap's pixels will be marked as immutable, but the installPixels()
   // API requires a non-const pointer. So, cast away the const.
   void* const pixels = const_cast<void*>(mapping.memory());
@@ -166,6 +197,32 @@ void FrameSubscriber::Done(const gfx::Rect& damage, const SkBitmap& frame) {
   callback_.Run(gfx::Image::CreateFrom1xBitmap(copy), damage);
 }
 
+void FrameSubscriber::EncodeFrame(
+    base::ReadOnlySharedMemoryMapping mapping,
+    const ::media::mojom::VideoFrameInfo& info,
+    mojo::PendingRemote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
+        callbacks) {
+  // Wrap the shared memory instead of copying it; the encoder reads the
+  // planes straight from the capturer's buffer.
+  scoped_refptr<media::VideoFrame> frame = media::VideoFrame::WrapExternalData(
+      info.pixel_format, info.coded_size, info.visible_rect,
+      info.visible_rect.size(), static_cast<const uint8_t*>(mapping.memory()),
+      mapping.size(), info.timestamp);
+  if (!frame)
+    return;
+
+  // The frame is released on the encoder sequence. Keep the mapping alive
+  // and hold the unbound callbacks pipe until then so the capturer doesn't
+  // recycle the buffer; closing the pipe signals that we are done with it.
+  frame->AddDestructionObserver(base::BindOnce(
+      [](base::ReadOnlySharedMemoryMapping mapping,
+         mojo::PendingRemote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
+             callbacks) {},
+      std::move(mapping), std::move(callbacks)));
+
+  encoder_->EncodeFrame(std::move(frame));
+}
+
 gfx::Size FrameSubscriber::GetRenderViewSize() const {
   content::RenderWidgetHostView* view = host_->GetView();
   gfx::Size size = view->GetViewBounds().size();
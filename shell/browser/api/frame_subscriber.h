@@ -10,10 +10,12 @@
 
 #include "base/functional/callback_forward.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/shared_memory_mapping.h"
 #include "base/memory/weak_ptr.h"
 #include "components/viz/host/client_frame_sink_video_capturer.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "media/capture/mojom/video_capture_buffer.mojom-forward.h"
+#include "ui/gfx/geometry/size.h"
 #include "v8/include/v8-forward.h"
 
 namespace gfx {
@@ -28,6 +30,7 @@ class PendingRemote;
 
 namespace electron::api {
 
+class FrameEncoder;
 class WebContents;
 
 class FrameSubscriber : private content::WebContentsObserver,
@@ -39,12 +42,19 @@ class FrameSubscriber : private content::WebContentsObserver,
   FrameSubscriber(content::WebContents* web_contents,
                   const FrameCaptureCallback& callback,
                   bool only_dirty);
+  // Feeds captured frames directly into |encoder| instead of copying them
+  // into a gfx::Image for JS.
+  FrameSubscriber(content::WebContents* web_contents,
+                  std::unique_ptr<FrameEncoder> encoder);
   ~FrameSubscriber() override;
 
   // disable copy
   FrameSubscriber(const FrameSubscriber&) = delete;
   FrameSubscriber& operator=(const FrameSubscriber&) = delete;
 
+  // Stops capturing and releases the encoder so that it can be flushed.
+  std::unique_ptr<FrameEncoder> TakeEncoder();
+
  private:
   void AttachToHost(content::RenderWidgetHost* host);
   void DetachFromHost();
@@ -67,12 +77,20 @@ class FrameSubscriber : private content::WebContentsObserver,
   void OnLog(const std::string& message) override {}
 
   void Done(const gfx::Rect& damage, const SkBitmap& frame);
+  void EncodeFrame(base::ReadOnlySharedMemoryMapping mapping,
+                   const ::media::mojom::VideoFrameInfo& info,
+                   mojo::PendingRemote<
+                       viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
+                       callbacks);
 
   // Get the pixel size of render view.
   gfx::Size GetRenderViewSize() const;
 
   FrameCaptureCallback callback_;
-  bool only_dirty_;
+  bool only_dirty_ = false;
+  std::unique_ptr<FrameEncoder> encoder_;
+  // Size of the frames fed to |encoder_|, which is that of the first view.
+  gfx::Size encoded_size_;
 
   raw_ptr<content::RenderWidgetHost> host_;
   std::unique_ptr<viz::ClientFrameSinkVideoCapturer> video_capturer_;
@@ -102,6 +102,7 @@
 #include "shell/browser/notifications/notification_presenter.h"
 #include "shell/browser/notifications/platform_notification_service.h"
 #include "shell/browser/protocol_registry.h"
+#include "shell/browser/renderer_process_pool.h"
 #include "shell/browser/serial/electron_serial_delegate.h"
 #include "shell/browser/session_preferences.h"
 #include "shell/browser/ui/devtools_manager_delegate.h"
@@ -581,6 +582,11 @@ void ElectronBrowserClient::AppendExtraCommandLineSwitches(
       if (web_preferences)
         web_preferences->AppendCommandLineSwitches(
             command_line, IsRendererSubFrame(unsafe_process_id));
+    } else if (auto* host = content::RenderProcessHost::FromID(process_id)) {
+      // Processes launched ahead of use by the session's pool.
+      auto* browser_context = host->GetBrowserContext();
+      if (auto* pool = RendererProcessPool::FromBrowserContext(browser_context))
+        pool->AppendCommandLineSwitches(host, command_line);
     }
 
     // Service worker processes should only run preloads if one has been
@@ -748,6 +754,13 @@ void ElectronBrowserClient::SiteInstanceGotProcessAndSite(
 bool ElectronBrowserClient::IsSuitableHost(
     content::RenderProcessHost* process_host,
     const GURL& site_url) {
+  // Processes of the renderer process pool are only used by the WebContents
+  // that claim them.
+  if (auto* pool = RendererProcessPool::FromBrowserContext(
+          process_host->GetBrowserContext());
+      pool && pool->IsReservedProcess(process_host))
+    return false;
+
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   auto* browser_context = process_host->GetBrowserContext();
   extensions::ProcessMap* process_map =
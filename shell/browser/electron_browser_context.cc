@@ -53,6 +53,7 @@
 #include "shell/browser/media/media_device_id_salt.h"
 #include "shell/browser/net/resolve_proxy_helper.h"
 #include "shell/browser/protocol_registry.h"
+#include "shell/browser/renderer_process_pool.h"
 #include "shell/browser/serial/serial_chooser_context.h"
 #include "shell/browser/special_storage_policy.h"
 #include "shell/browser/ui/inspectable_web_contents.h"
@@ -410,6 +411,9 @@ ElectronBrowserContext::ElectronBrowserContext(
 
 ElectronBrowserContext::~ElectronBrowserContext() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  // The pool holds a WebContents and SiteInstances of this context, which
+  // must go away while the context is still whole.
+  RendererProcessPool::DestroyForBrowserContext(this);
   NotifyWillBeDestroyed();
 
   // Notify any keyed services of browser context destruction.
@@ -5,6 +5,7 @@
 
 #include "shell/browser/microtasks_runner.h"
 
+#include "base/trace_event/trace_event.h"
 #include "shell/browser/electron_browser_main_parts.h"
 #include "shell/common/node_includes.h"
 #include "v8/include/v8.h"
@@ -13,6 +14,8 @@ namespace electron {
 
 MicrotasksRunner::MicrotasksRunner(v8::Isolate* isolate) : isolate_(isolate) {}
 
+MicrotasksRunner::~MicrotasksRunner() = default;
+
 void MicrotasksRunner::WillProcessTask(const base::PendingTask& pending_task,
                                        bool was_blocked_or_low_priority) {}
 
@@ -26,11 +29,40 @@ void MicrotasksRunner::DidProcessTask(const base::PendingTask& pending_task) {
   // contention for performing checkpoint between Node.js and chromium, ending
   // up Node.js delaying its callbacks. To fix this, now we always lets Node.js
   // handle the checkpoint in the browser process.
+  //
+  // Most tasks don't run any JS, or run it in a callback scope of their own
+  // that already drained both queues, so take a shortcut when Node has no
+  // ticks or rejections pending and no callback scope is open further up the
+  // stack: closing a callback scope would then only perform V8's microtask
+  // checkpoint and release the WeakRef targets kept alive by the task. Inside
+  // a nested run loop the full scope is needed, as it defers microtasks until
+  // the outer scope closes. So is it if the checkpoint scheduled a tick.
+  v8::HandleScope handle_scope(isolate_);
+  node::Environment* env = node::Environment::GetCurrent(isolate_);
+  if (env && env->can_call_into_js() &&
+      env->async_callback_scope_depth() == 0) {
+    node::TickInfo* tick_info = env->tick_info();
+    if (!tick_info->has_tick_scheduled() &&
+        !tick_info->has_rejection_to_warn()) {
+      env->context()->GetMicrotaskQueue()->PerformCheckpoint(isolate_);
+      isolate_->ClearKeptObjects();
+      if (!tick_info->has_tick_scheduled() &&
+          !tick_info->has_rejection_to_warn()) {
+        TRACE_COUNTER1("electron", "MicrotasksRunner::CheckpointsSkipped",
+                       ++checkpoints_skipped_);
+        return;
+      }
+    }
+  }
+
+  if (resource_.IsEmpty())
+    resource_.Reset(isolate_, v8::Object::New(isolate_));
   {
-    v8::HandleScope handle_scope(isolate_);
-    node::CallbackScope microtasks_scope(isolate_, v8::Object::New(isolate_),
+    node::CallbackScope microtasks_scope(isolate_, resource_.Get(isolate_),
                                          {0, 0});
   }
+  TRACE_COUNTER1("electron", "MicrotasksRunner::CheckpointsPerformed",
+                 ++checkpoints_performed_);
 }
 
 }  // namespace electron
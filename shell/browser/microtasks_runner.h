@@ -5,12 +5,16 @@
 #ifndef ELECTRON_SHELL_BROWSER_MICROTASKS_RUNNER_H_
 #define ELECTRON_SHELL_BROWSER_MICROTASKS_RUNNER_H_
 
+#include <cstdint>
+
 #include "base/memory/raw_ptr.h"
 #include "base/task/task_observer.h"
+#include "v8/include/v8-persistent-handle.h"
 
 namespace v8 {
 class Isolate;
-}
+class Object;
+}  // namespace v8
 
 namespace electron {
 
@@ -23,6 +27,11 @@ namespace electron {
 class MicrotasksRunner : public base::TaskObserver {
  public:
   explicit MicrotasksRunner(v8::Isolate* isolate);
+  ~MicrotasksRunner() override;
+
+  // disable copy
+  MicrotasksRunner(const MicrotasksRunner&) = delete;
+  MicrotasksRunner& operator=(const MicrotasksRunner&) = delete;
 
   // base::TaskObserver
   void WillProcessTask(const base::PendingTask& pending_task,
@@ -31,6 +40,13 @@ class MicrotasksRunner : public base::TaskObserver {
 
  private:
   raw_ptr<v8::Isolate> isolate_;
+
+  // The resource of the callback scope, reused across checkpoints.
+  v8::Global<v8::Object> resource_;
+
+  // Reported as trace counters.
+  uint64_t checkpoints_performed_ = 0;
+  uint64_t checkpoints_skipped_ = 0;
 };
 
 }  // namespace electron
@@ -0,0 +1,364 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/net/directory_url_loader_factory.h"
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_util.h"
+#include "base/i18n/time_formatting.h"
+#include "base/strings/escape.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
+#include "build/build_config.h"
+#include "mojo/public/cpp/base/big_buffer.h"
+#include "mojo/public/cpp/bindings/receiver.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/bindings/self_owned_receiver.h"
+#include "net/base/filename_util.h"
+#include "net/http/http_byte_range.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_util.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
+#include "services/network/public/mojom/early_hints.mojom.h"
+#include "services/network/public/mojom/url_loader.mojom.h"
+#include "services/network/public/mojom/url_response_head.mojom.h"
+#include "shell/browser/net/asar/asar_url_loader.h"
+#include "shell/common/asar/archive.h"
+#include "shell/common/asar/asar_util.h"
+#include "third_party/abseil-cpp/absl/strings/str_format.h"
+
+namespace electron {
+
+namespace {
+
+struct FileStat {
+  bool is_directory = false;
+  int64_t size = 0;
+  base::Time last_modified;
+};
+
+// Stats |path|, looking into asar archives.
+std::optional<FileStat> StatFile(const base::FilePath& path) {
+  base::FilePath asar_path, relative_path;
+  if (asar::GetAsarArchivePath(path, &asar_path, &relative_path,
+                               /*allow_root=*/true)) {
+    std::shared_ptr<asar::Archive> archive =
+        asar::GetOrCreateAsarArchive(asar_path);
+    asar::Archive::Stats stats;
+    if (!archive)
+      return std::nullopt;
+    const bool is_root = relative_path.empty();
+    if (!is_root && !archive->Stat(relative_path, &stats))
+      return std::nullopt;
+    // Files in an archive share its modification time.
+    base::File::Info archive_info;
+    if (!base::GetFileInfo(asar_path, &archive_info))
+      return std::nullopt;
+    return FileStat{
+        is_root || stats.type == asar::Archive::FileType::kDirectory,
+        static_cast<int64_t>(stats.size), archive_info.last_modified};
+  }
+
+  base::File::Info info;
+  if (!base::GetFileInfo(path, &info))
+    return std::nullopt;
+  return FileStat{info.is_directory, info.size, info.last_modified};
+}
+
+// Maps a URL path to a file under |root|. Returns nullopt for paths that
+// would escape |root|.
+std::optional<base::FilePath> ResolvePath(const base::FilePath& root,
+                                          std::string_view url_path) {
+  const std::string path = base::UnescapeBinaryURLComponent(url_path);
+  base::FilePath result = root;
+  for (const std::string_view component : base::SplitStringPiece(
+           path, "/", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    if (component == ".")
+      continue;
+    if (component == ".." || component.find('\\') != std::string_view::npos ||
+        component.find('\0') != std::string_view::npos) {
+      return std::nullopt;
+    }
+#if BUILDFLAG(IS_WIN)
+    // Drive letters and alternate data streams.
+    if (component.find(':') != std::string_view::npos)
+      return std::nullopt;
+#endif
+    result = result.Append(base::FilePath::FromUTF8Unsafe(component));
+  }
+  return result;
+}
+
+// Lowercase extension of |path| without the leading dot.
+std::string GetExtension(const base::FilePath& path) {
+  const std::string extension =
+      base::FilePath(path.FinalExtension()).AsUTF8Unsafe();
+  return extension.empty() ? extension
+                           : base::ToLowerASCII(extension.substr(1));
+}
+
+std::string GetETag(const FileStat& stat) {
+  return absl::StrFormat(
+      "\"%x-%x\"", static_cast<uint64_t>(stat.size),
+      static_cast<uint64_t>(
+          stat.last_modified.ToDeltaSinceWindowsEpoch().InMicroseconds()));
+}
+
+// Whether the client's cached copy, described by the conditional headers of
+// |request|, is still current. If-None-Match takes precedence over
+// If-Modified-Since as described in RFC 9110 section 13.2.2.
+bool IsNotModified(const network::ResourceRequest& request,
+                   const std::string& etag,
+                   base::Time last_modified) {
+  if (const std::optional<std::string> if_none_match =
+          request.headers.GetHeader(net::HttpRequestHeaders::kIfNoneMatch)) {
+    for (std::string_view tag : base::SplitStringPiece(
+             *if_none_match, ",", base::TRIM_WHITESPACE,
+             base::SPLIT_WANT_NONEMPTY)) {
+      if (tag == "*" || tag == etag ||
+          (base::StartsWith(tag, "W/") && tag.substr(2) == etag)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  if (const std::optional<std::string> if_modified_since =
+          request.headers.GetHeader(
+              net::HttpRequestHeaders::kIfModifiedSince)) {
+    base::Time since;
+    // HTTP dates have a resolution of one second.
+    return base::Time::FromUTCString(if_modified_since->c_str(), &since) &&
+           last_modified.ToDeltaSinceWindowsEpoch().InSeconds() <=
+               since.ToDeltaSinceWindowsEpoch().InSeconds();
+  }
+
+  return false;
+}
+
+// Sits between the file loader and the client to complete the response head
+// with the validators, the range and the configured headers.
+class ResponseHeadRewriter : public network::mojom::URLLoaderClient {
+ public:
+  ResponseHeadRewriter(
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      base::StringPairs headers,
+      std::optional<std::string> content_range,
+      std::optional<std::string> mime_type)
+      : client_(std::move(client)),
+        headers_(std::move(headers)),
+        content_range_(std::move(content_range)),
+        mime_type_(std::move(mime_type)) {}
+
+  // disable copy
+  ResponseHeadRewriter(const ResponseHeadRewriter&) = delete;
+  ResponseHeadRewriter& operator=(const ResponseHeadRewriter&) = delete;
+
+  // network::mojom::URLLoaderClient:
+  void OnReceiveEarlyHints(network::mojom::EarlyHintsPtr early_hints) override {
+    client_->OnReceiveEarlyHints(std::move(early_hints));
+  }
+  void OnReceiveResponse(
+      network::mojom::URLResponseHeadPtr head,
+      mojo::ScopedDataPipeConsumerHandle body,
+      std::optional<mojo_base::BigBuffer> cached_metadata) override {
+    if (!head->headers) {
+      head->headers =
+          base::MakeRefCounted<net::HttpResponseHeaders>("HTTP/1.1 200 OK");
+    }
+    if (content_range_) {
+      head->headers->ReplaceStatusLine("HTTP/1.1 206 Partial Content");
+      head->headers->SetHeader("Content-Range", *content_range_);
+    }
+    if (mime_type_) {
+      head->mime_type = *mime_type_;
+      head->did_mime_sniff = false;
+      head->headers->SetHeader(net::HttpRequestHeaders::kContentType,
+                               *mime_type_);
+    }
+    for (const auto& [name, value] : headers_)
+      head->headers->SetHeader(name, value);
+    client_->OnReceiveResponse(std::move(head), std::move(body),
+                               std::move(cached_metadata));
+  }
+  void OnReceiveRedirect(const net::RedirectInfo& redirect_info,
+                         network::mojom::URLResponseHeadPtr head) override {
+    client_->OnReceiveRedirect(redirect_info, std::move(head));
+  }
+  void OnUploadProgress(int64_t current_position,
+                        int64_t total_size,
+                        OnUploadProgressCallback callback) override {
+    client_->OnUploadProgress(current_position, total_size,
+                              std::move(callback));
+  }
+  void OnTransferSizeUpdated(int32_t transfer_size_diff) override {
+    client_->OnTransferSizeUpdated(transfer_size_diff);
+  }
+  void OnComplete(const network::URLLoaderCompletionStatus& status) override {
+    client_->OnComplete(status);
+  }
+
+ private:
+  mojo::Remote<network::mojom::URLLoaderClient> client_;
+  const base::StringPairs headers_;
+  const std::optional<std::string> content_range_;
+  const std::optional<std::string> mime_type_;
+};
+
+void SendNotModified(
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    const base::StringPairs& headers) {
+  mojo::Remote<network::mojom::URLLoaderClient> client_remote(
+      std::move(client));
+
+  mojo::ScopedDataPipeProducerHandle producer;
+  mojo::ScopedDataPipeConsumerHandle consumer;
+  if (mojo::CreateDataPipe(nullptr, producer, consumer) != MOJO_RESULT_OK) {
+    client_remote->OnComplete(
+        network::URLLoaderCompletionStatus(net::ERR_INSUFFICIENT_RESOURCES));
+    return;
+  }
+
+  auto head = network::mojom::URLResponseHead::New();
+  head->headers = base::MakeRefCounted<net::HttpResponseHeaders>(
+      "HTTP/1.1 304 Not Modified");
+  for (const auto& [name, value] : headers)
+    head->headers->SetHeader(name, value);
+  head->content_length = 0;
+  client_remote->OnReceiveResponse(std::move(head), std::move(consumer),
+                                   std::nullopt);
+  producer.reset();  // The body is empty.
+  client_remote->OnComplete(network::URLLoaderCompletionStatus(net::OK));
+}
+
+// Runs on a background sequence.
+void StartLoading(const DirectoryURLLoaderFactory::Options& options,
+                  network::ResourceRequest request,
+                  mojo::PendingReceiver<network::mojom::URLLoader> loader,
+                  mojo::PendingRemote<network::mojom::URLLoaderClient> client) {
+  std::optional<base::FilePath> path =
+      ResolvePath(options.root, request.url.path_piece());
+  std::optional<FileStat> stat;
+  if (path) {
+    stat = StatFile(*path);
+    if (stat && stat->is_directory) {
+      *path = path->Append(FILE_PATH_LITERAL("index.html"));
+      stat = StatFile(*path);
+    }
+  }
+
+  if ((!stat || stat->is_directory) && !options.spa_fallback.empty() &&
+      path && path->FinalExtension().empty()) {
+    path = ResolvePath(options.root, options.spa_fallback);
+    stat = path ? StatFile(*path) : std::nullopt;
+  }
+
+  if (!stat || stat->is_directory) {
+    mojo::Remote<network::mojom::URLLoaderClient>(std::move(client))
+        ->OnComplete(network::URLLoaderCompletionStatus(
+            path ? net::ERR_FILE_NOT_FOUND : net::ERR_ACCESS_DENIED));
+    return;
+  }
+
+  base::StringPairs headers = options.headers;
+  const std::string etag = GetETag(*stat);
+  headers.emplace_back("ETag", etag);
+  headers.emplace_back("Last-Modified",
+                       base::TimeFormatHTTP(stat->last_modified));
+  headers.emplace_back("Accept-Ranges", "bytes");
+
+  if (IsNotModified(request, etag, stat->last_modified)) {
+    SendNotModified(std::move(client), headers);
+    return;
+  }
+
+  // Only a single range is supported; the file loader fails the request for
+  // anything else.
+  std::optional<std::string> content_range;
+  if (const std::optional<std::string> range_header =
+          request.headers.GetHeader(net::HttpRequestHeaders::kRange)) {
+    std::vector<net::HttpByteRange> ranges;
+    if (net::HttpUtil::ParseRangeHeader(*range_header, &ranges) &&
+        ranges.size() == 1 && ranges[0].ComputeBounds(stat->size)) {
+      content_range = absl::StrFormat("bytes %d-%d/%d",
+                                      ranges[0].first_byte_position(),
+                                      ranges[0].last_byte_position(),
+                                      stat->size);
+    }
+  }
+
+  std::optional<std::string> mime_type;
+  if (auto it = options.mime_overrides.find(GetExtension(*path));
+      it != options.mime_overrides.end()) {
+    mime_type = it->second;
+  }
+
+  mojo::PendingRemote<network::mojom::URLLoaderClient> rewriter;
+  mojo::MakeSelfOwnedReceiver(
+      std::make_unique<ResponseHeadRewriter>(std::move(client),
+                                             std::move(headers),
+                                             std::move(content_range),
+                                             std::move(mime_type)),
+      rewriter.InitWithNewPipeAndPassReceiver());
+
+  request.url = net::FilePathToFileURL(*path);
+  asar::CreateAsarURLLoader(
+      request, std::move(loader), std::move(rewriter),
+      base::MakeRefCounted<net::HttpResponseHeaders>("HTTP/1.1 200 OK"));
+}
+
+}  // namespace
+
+DirectoryURLLoaderFactory::Options::Options() = default;
+DirectoryURLLoaderFactory::Options::Options(const Options&) = default;
+DirectoryURLLoaderFactory::Options&
+DirectoryURLLoaderFactory::Options::operator=(const Options&) = default;
+DirectoryURLLoaderFactory::Options::~Options() = default;
+
+// static
+mojo::PendingRemote<network::mojom::URLLoaderFactory>
+DirectoryURLLoaderFactory::Create(const Options& options) {
+  mojo::PendingRemote<network::mojom::URLLoaderFactory> pending_remote;
+
+  // The DirectoryURLLoaderFactory will delete itself when there are no more
+  // receivers - see the SelfDeletingURLLoaderFactory::OnDisconnect method.
+  new DirectoryURLLoaderFactory(
+      options, pending_remote.InitWithNewPipeAndPassReceiver());
+
+  return pending_remote;
+}
+
+DirectoryURLLoaderFactory::DirectoryURLLoaderFactory(
+    const Options& options,
+    mojo::PendingReceiver<network::mojom::URLLoaderFactory> factory_receiver)
+    : network::SelfDeletingURLLoaderFactory(std::move(factory_receiver)),
+      options_(options) {}
+
+DirectoryURLLoaderFactory::~DirectoryURLLoaderFactory() = default;
+
+void DirectoryURLLoaderFactory::CreateLoaderAndStart(
+    mojo::PendingReceiver<network::mojom::URLLoader> loader,
+    int32_t request_id,
+    uint32_t options,
+    const network::ResourceRequest& request,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    const net::MutableNetworkTrafficAnnotationTag& traffic_annotation) {
+  // The response head rewriter is bound to this sequence.
+  auto task_runner = base::ThreadPool::CreateSequencedTaskRunner(
+      {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
+  task_runner->PostTask(FROM_HERE,
+                        base::BindOnce(&StartLoading, options_, request,
+                                       std::move(loader), std::move(client)));
+}
+
+}  // namespace electron
@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_NET_DIRECTORY_URL_LOADER_FACTORY_H_
+#define ELECTRON_SHELL_BROWSER_NET_DIRECTORY_URL_LOADER_FACTORY_H_
+
+#include <string>
+
+#include "base/containers/flat_map.h"
+#include "base/files/file_path.h"
+#include "base/strings/string_split.h"
+#include "services/network/public/cpp/self_deleting_url_loader_factory.h"
+
+namespace mojo {
+template <typename T>
+class PendingReceiver;
+template <typename T>
+class PendingRemote;
+}  // namespace mojo
+
+namespace electron {
+
+// Serves the files under a directory, which may be or be inside an asar
+// archive, for a custom scheme. Paths are resolved, conditional and range
+// requests are answered and files are streamed on a background sequence, so
+// requests never wait for the main thread.
+class DirectoryURLLoaderFactory : public network::SelfDeletingURLLoaderFactory {
+ public:
+  struct Options {
+    Options();
+    Options(const Options&);
+    Options& operator=(const Options&);
+    ~Options();
+
+    // Absolute path of the directory to serve.
+    base::FilePath root;
+    // Headers added to every response.
+    base::StringPairs headers;
+    // Path relative to |root| served for missing paths that have no file
+    // extension, e.g. "index.html" for single-page apps.
+    std::string spa_fallback;
+    // MIME types keyed by lowercase file extension without the leading dot.
+    base::flat_map<std::string, std::string> mime_overrides;
+  };
+
+  static mojo::PendingRemote<network::mojom::URLLoaderFactory> Create(
+      const Options& options);
+
+ private:
+  DirectoryURLLoaderFactory(
+      const Options& options,
+      mojo::PendingReceiver<network::mojom::URLLoaderFactory> factory_receiver);
+  ~DirectoryURLLoaderFactory() override;
+
+  // network::mojom::URLLoaderFactory:
+  void CreateLoaderAndStart(
+      mojo::PendingReceiver<network::mojom::URLLoader> loader,
+      int32_t request_id,
+      uint32_t options,
+      const network::ResourceRequest& request,
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      const net::MutableNetworkTrafficAnnotationTag& traffic_annotation)
+      override;
+
+  const Options options_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_NET_DIRECTORY_URL_LOADER_FACTORY_H_
@@ -4,6 +4,7 @@
 
 #include "shell/browser/net/electron_url_loader_factory.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -11,6 +12,8 @@
 #include <vector>
 
 #include "base/containers/fixed_flat_map.h"
+#include "base/memory/raw_span.h"
+#include "base/memory/ref_counted_memory.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
@@ -25,6 +28,7 @@
 #include "net/http/http_request_headers.h"
 #include "net/http/http_status_code.h"
 #include "net/url_request/redirect_util.h"
+#include "services/network/public/cpp/features.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
@@ -43,6 +47,7 @@
 #include "shell/common/gin_converters/net_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/v8_util.h"
 #include "third_party/abseil-cpp/absl/strings/str_format.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 
@@ -171,10 +176,48 @@ network::mojom::URLResponseHeadPtr ToResponseHead(
   return head;
 }
 
-// Helper to write string to pipe.
+// Keeps the backing store of an ArrayBufferView alive, so that its contents
+// can be written to the data pipe without first being copied out of V8.
+class BackingStoreMemory : public base::RefCountedMemory {
+ public:
+  explicit BackingStoreMemory(v8::Local<v8::ArrayBufferView> view)
+      : backing_store_(view->Buffer()->GetBackingStore()),
+        data_(util::as_byte_span(view)) {}
+
+  // disable copy
+  BackingStoreMemory(const BackingStoreMemory&) = delete;
+  BackingStoreMemory& operator=(const BackingStoreMemory&) = delete;
+
+ private:
+  ~BackingStoreMemory() override = default;
+
+  // base::RefCountedMemory:
+  base::span<const uint8_t> AsSpan() const override { return data_; }
+
+  std::shared_ptr<v8::BackingStore> backing_store_;
+  base::raw_span<const uint8_t> data_;
+};
+
+// Creates a data pipe large enough to hold a body of |size| bytes in one go,
+// within the limits used by the network service.
+MojoResult CreateDataPipeForBody(size_t size,
+                                 mojo::ScopedDataPipeProducerHandle& producer,
+                                 mojo::ScopedDataPipeConsumerHandle& consumer) {
+  MojoCreateDataPipeOptions options;
+  options.struct_size = sizeof(MojoCreateDataPipeOptions);
+  options.flags = MOJO_CREATE_DATA_PIPE_FLAG_NONE;
+  options.element_num_bytes = 1;
+  options.capacity_num_bytes = std::clamp<size_t>(
+      size, 1,
+      network::features::GetDataPipeDefaultAllocationSize(
+          network::features::DataPipeAllocationSize::kLargerSizeIfPossible));
+  return mojo::CreateDataPipe(&options, producer, consumer);
+}
+
+// Helper to write a response body to pipe.
 struct WriteData {
   mojo::Remote<network::mojom::URLLoaderClient> client;
-  std::string data;
+  scoped_refptr<base::RefCountedMemory> data;
   std::unique_ptr<mojo::DataPipeProducer> producer;
 };
 
@@ -182,9 +225,9 @@ void OnWrite(std::unique_ptr<WriteData> write_data, MojoResult result) {
   network::URLLoaderCompletionStatus status(net::ERR_FAILED);
   if (result == MOJO_RESULT_OK) {
     status = network::URLLoaderCompletionStatus(net::OK);
-    status.encoded_data_length = write_data->data.size();
-    status.encoded_body_length = write_data->data.size();
-    status.decoded_body_length = write_data->data.size();
+    status.encoded_data_length = write_data->data->size();
+    status.encoded_body_length = write_data->data->size();
+    status.decoded_body_length = write_data->data->size();
   }
   write_data->client->OnComplete(status);
 }
@@ -387,12 +430,13 @@ void ElectronURLLoaderFactory::RedirectedRequest::DeleteThis() {
 // static
 mojo::PendingRemote<network::mojom::URLLoaderFactory>
 ElectronURLLoaderFactory::Create(ProtocolType type,
-                                 const ProtocolHandler& handler) {
+                                 const ProtocolHandler& handler,
+                                 scoped_refptr<ProtocolResponseCache> cache) {
   mojo::PendingRemote<network::mojom::URLLoaderFactory> pending_remote;
 
   // The ElectronURLLoaderFactory will delete itself when there are no more
   // receivers - see the SelfDeletingURLLoaderFactory::OnDisconnect method.
-  new ElectronURLLoaderFactory(type, handler,
+  new ElectronURLLoaderFactory(type, handler, std::move(cache),
                                pending_remote.InitWithNewPipeAndPassReceiver());
 
   return pending_remote;
@@ -401,10 +445,12 @@ ElectronURLLoaderFactory::Create(ProtocolType type,
 ElectronURLLoaderFactory::ElectronURLLoaderFactory(
     ProtocolType type,
     const ProtocolHandler& handler,
+    scoped_refptr<ProtocolResponseCache> cache,
     mojo::PendingReceiver<network::mojom::URLLoaderFactory> factory_receiver)
     : network::SelfDeletingURLLoaderFactory(std::move(factory_receiver)),
       type_(type),
-      handler_(handler) {}
+      handler_(handler),
+      cache_(std::move(cache)) {}
 
 ElectronURLLoaderFactory::~ElectronURLLoaderFactory() = default;
 
@@ -417,6 +463,47 @@ void ElectronURLLoaderFactory::CreateLoaderAndStart(
     const net::MutableNetworkTrafficAnnotationTag& traffic_annotation) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
 
+  if (!cache_) {
+    RunHandler(std::move(loader), request_id, options, request,
+               traffic_annotation, std::move(client), request);
+    return;
+  }
+
+  // Fresh cache hits are answered without calling into JS at all.
+  cache_->Start(request, std::move(client),
+                base::BindOnce(&ElectronURLLoaderFactory::RunHandlerIfAlive,
+                               weak_factory_.GetWeakPtr(), std::move(loader),
+                               request_id, options, request,
+                               traffic_annotation));
+}
+
+// static
+void ElectronURLLoaderFactory::RunHandlerIfAlive(
+    base::WeakPtr<ElectronURLLoaderFactory> factory,
+    mojo::PendingReceiver<network::mojom::URLLoader> loader,
+    int32_t request_id,
+    uint32_t options,
+    const network::ResourceRequest& request,
+    const net::MutableNetworkTrafficAnnotationTag& traffic_annotation,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    const network::ResourceRequest& handler_request) {
+  if (!factory) {
+    OnComplete(std::move(client), request_id,
+               network::URLLoaderCompletionStatus(net::ERR_ABORTED));
+    return;
+  }
+  factory->RunHandler(std::move(loader), request_id, options, request,
+                      traffic_annotation, std::move(client), handler_request);
+}
+
+void ElectronURLLoaderFactory::RunHandler(
+    mojo::PendingReceiver<network::mojom::URLLoader> loader,
+    int32_t request_id,
+    uint32_t options,
+    const network::ResourceRequest& request,
+    const net::MutableNetworkTrafficAnnotationTag& traffic_annotation,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    const network::ResourceRequest& handler_request) {
   // |StartLoading| is used for both intercepted and registered protocols,
   // and on redirects it needs a factory to use to create a loader for the
   // new request. So in this case, this factory is the target factory.
@@ -424,10 +511,11 @@ void ElectronURLLoaderFactory::CreateLoaderAndStart(
   this->Clone(target_factory.InitWithNewPipeAndPassReceiver());
 
   handler_.Run(
-      request,
+      handler_request,
       base::BindOnce(&ElectronURLLoaderFactory::StartLoading, std::move(loader),
                      request_id, options, request, std::move(client),
-                     traffic_annotation, std::move(target_factory), type_));
+                     traffic_annotation, std::move(target_factory), type_,
+                     cache_));
 }
 
 // static
@@ -452,6 +540,7 @@ void ElectronURLLoaderFactory::StartLoading(
     const net::MutableNetworkTrafficAnnotationTag& traffic_annotation,
     mojo::PendingRemote<network::mojom::URLLoaderFactory> target_factory,
     ProtocolType type,
+    scoped_refptr<ProtocolResponseCache> cache,
     gin::Arguments* args) {
   // Send network error when there is no argument passed.
   //
@@ -526,17 +615,29 @@ void ElectronURLLoaderFactory::StartLoading(
     return;
   }
 
+  // The handler answered a revalidation issued by the cache.
+  if (cache && cache->IsNotModified(request, *head)) {
+    cache->ServeNotModified(request, *head, std::move(client));
+    return;
+  }
+
+  ResponseRecorder recorder =
+      cache ? cache->MaybeRecord(request, *head) : ResponseRecorder();
+  const size_t max_recorded_size = cache ? cache->max_entry_size() : 0;
+
   switch (type) {
     // DEPRECATED: Soon only |kFree| will be supported!
     case ProtocolType::kBuffer:
       if (response->IsArrayBufferView())
         StartLoadingBuffer(std::move(client), std::move(head),
-                           response.As<v8::ArrayBufferView>());
+                           response.As<v8::ArrayBufferView>(),
+                           std::move(recorder));
       else if (v8::Local<v8::Value> data; !dict.IsEmpty() &&
                                           dict.Get("data", &data) &&
                                           data->IsArrayBufferView())
         StartLoadingBuffer(std::move(client), std::move(head),
-                           data.As<v8::ArrayBufferView>());
+                           data.As<v8::ArrayBufferView>(),
+                           std::move(recorder));
       else
         OnComplete(std::move(client), request_id,
                    network::URLLoaderCompletionStatus(net::ERR_FAILED));
@@ -544,9 +645,11 @@ void ElectronURLLoaderFactory::StartLoading(
     case ProtocolType::kString: {
       std::string data;
       if (gin::ConvertFromV8(args->isolate(), response, &data))
-        SendContents(std::move(client), std::move(head), data);
+        SendContents(std::move(client), std::move(head), data,
+                     std::move(recorder));
       else if (!dict.IsEmpty() && dict.Get("data", &data))
-        SendContents(std::move(client), std::move(head), data);
+        SendContents(std::move(client), std::move(head), data,
+                     std::move(recorder));
       else
         OnComplete(std::move(client), request_id,
                    network::URLLoaderCompletionStatus(net::ERR_FAILED));
@@ -575,7 +678,7 @@ void ElectronURLLoaderFactory::StartLoading(
       break;
     case ProtocolType::kStream:
       StartLoadingStream(std::move(client), std::move(loader), std::move(head),
-                         dict);
+                         dict, std::move(recorder), max_recorded_size);
       break;
 
     case ProtocolType::kFree: {
@@ -589,13 +692,16 @@ void ElectronURLLoaderFactory::StartLoading(
       // |data| can be either a string, a buffer or a stream.
       if (data->IsArrayBufferView()) {
         StartLoadingBuffer(std::move(client), std::move(head),
-                           data.As<v8::ArrayBufferView>());
+                           data.As<v8::ArrayBufferView>(),
+                           std::move(recorder));
       } else if (data->IsString()) {
         SendContents(std::move(client), std::move(head),
-                     gin::V8ToString(args->isolate(), data));
+                     gin::V8ToString(args->isolate(), data),
+                     std::move(recorder));
       } else if (LooksLikeStream(args->isolate(), data)) {
         StartLoadingStream(std::move(client), std::move(loader),
-                           std::move(head), dict);
+                           std::move(head), dict, std::move(recorder),
+                           max_recorded_size);
       } else if (!dict.IsEmpty()) {
         // |data| wasn't specified, so look for |response.url| or
         // |response.path|.
@@ -622,10 +728,19 @@ void ElectronURLLoaderFactory::StartLoading(
 void ElectronURLLoaderFactory::StartLoadingBuffer(
     mojo::PendingRemote<network::mojom::URLLoaderClient> client,
     network::mojom::URLResponseHeadPtr head,
-    v8::Local<v8::ArrayBufferView> buffer) {
-  SendContents(std::move(client), std::move(head),
-               std::string(node::Buffer::Data(buffer.As<v8::Value>()),
-                           node::Buffer::Length(buffer.As<v8::Value>())));
+    v8::Local<v8::ArrayBufferView> buffer,
+    ResponseRecorder recorder) {
+  // A cached body must not change when JS later writes to the buffer, so it
+  // gets its own copy, which is then also what is sent.
+  scoped_refptr<base::RefCountedMemory> data;
+  if (recorder) {
+    data = base::MakeRefCounted<base::RefCountedBytes>(
+        util::as_byte_span(buffer));
+  } else {
+    data = base::MakeRefCounted<BackingStoreMemory>(buffer);
+  }
+  SendContents(std::move(client), std::move(head), std::move(data),
+               std::move(recorder));
 }
 
 // static
@@ -688,7 +803,9 @@ void ElectronURLLoaderFactory::StartLoadingStream(
     mojo::PendingRemote<network::mojom::URLLoaderClient> client,
     mojo::PendingReceiver<network::mojom::URLLoader> loader,
     network::mojom::URLResponseHeadPtr head,
-    const gin_helper::Dictionary& dict) {
+    const gin_helper::Dictionary& dict,
+    ResponseRecorder recorder,
+    size_t max_recorded_size) {
   v8::Local<v8::Value> stream;
   if (!dict.Get("data", &stream)) {
     // Assume the opts is already a stream.
@@ -708,6 +825,10 @@ void ElectronURLLoaderFactory::StartLoadingStream(
     //
     // Note that We must submit a empty body otherwise NetworkService would
     // crash.
+    if (recorder) {
+      std::move(recorder).Run(head.Clone(),
+                              base::MakeRefCounted<base::RefCountedString>());
+    }
     client_remote->OnReceiveResponse(std::move(head), std::move(consumer),
                                      std::nullopt);
     producer.reset();  // The data pipe is empty.
@@ -733,24 +854,49 @@ void ElectronURLLoaderFactory::StartLoadingStream(
   }
 
   new NodeStreamLoader(std::move(head), std::move(loader), std::move(client),
-                       data.isolate(), data.GetHandle());
+                       data.isolate(), data.GetHandle(), std::move(recorder),
+                       max_recorded_size);
 }
 
 // static
 void ElectronURLLoaderFactory::SendContents(
     mojo::PendingRemote<network::mojom::URLLoaderClient> client,
     network::mojom::URLResponseHeadPtr head,
-    std::string data) {
-  mojo::Remote<network::mojom::URLLoaderClient> client_remote(
-      std::move(client));
+    std::string data,
+    ResponseRecorder recorder) {
+  SendContents(std::move(client), std::move(head),
+               base::MakeRefCounted<base::RefCountedString>(std::move(data)),
+               std::move(recorder));
+}
 
+// static
+void ElectronURLLoaderFactory::SendContents(
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    network::mojom::URLResponseHeadPtr head,
+    scoped_refptr<base::RefCountedMemory> data,
+    ResponseRecorder recorder) {
   // Add header to ignore CORS.
   head->headers->AddHeader("Access-Control-Allow-Origin", "*");
 
+  if (recorder)
+    std::move(recorder).Run(head.Clone(), data);
+
+  SendBody(std::move(client), std::move(head), std::move(data));
+}
+
+// static
+void ElectronURLLoaderFactory::SendBody(
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    network::mojom::URLResponseHeadPtr head,
+    scoped_refptr<base::RefCountedMemory> data) {
+  mojo::Remote<network::mojom::URLLoaderClient> client_remote(
+      std::move(client));
+
   // Code below follows the pattern of data_url_loader_factory.cc.
   mojo::ScopedDataPipeProducerHandle producer;
   mojo::ScopedDataPipeConsumerHandle consumer;
-  if (mojo::CreateDataPipe(nullptr, producer, consumer) != MOJO_RESULT_OK) {
+  if (CreateDataPipeForBody(data->size(), producer, consumer) !=
+      MOJO_RESULT_OK) {
     client_remote->OnComplete(
         network::URLLoaderCompletionStatus(net::ERR_INSUFFICIENT_RESOURCES));
     return;
@@ -766,7 +912,10 @@ void ElectronURLLoaderFactory::SendContents(
       std::make_unique<mojo::DataPipeProducer>(std::move(producer));
   auto* producer_ptr = write_data->producer.get();
 
-  std::string_view string_view(write_data->data);
+  // The producer writes from a background sequence; |write_data| keeps the
+  // body alive until it is done.
+  const std::string_view string_view =
+      base::as_string_view(base::span(*write_data->data));
   producer_ptr->Write(
       std::make_unique<mojo::StringDataSource>(
           string_view, mojo::StringDataSource::AsyncWritingMode::
@@ -11,6 +11,9 @@
 #include <utility>
 #include <vector>
 
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "mojo/public/cpp/bindings/receiver.h"
 #include "mojo/public/cpp/bindings/remote.h"
@@ -20,6 +23,7 @@
 #include "services/network/public/mojom/url_loader.mojom.h"
 #include "services/network/public/mojom/url_loader_factory.mojom.h"
 #include "services/network/public/mojom/url_response_head.mojom-forward.h"
+#include "shell/browser/net/protocol_response_cache.h"
 #include "v8/include/v8-array-buffer.h"
 
 namespace gin {
@@ -105,9 +109,11 @@ class ElectronURLLoaderFactory : public network::SelfDeletingURLLoaderFactory {
     mojo::Remote<network::mojom::URLLoaderFactory> target_factory_remote_;
   };
 
+  // When |cache| is set, responses are served from and recorded into it.
   static mojo::PendingRemote<network::mojom::URLLoaderFactory> Create(
       ProtocolType type,
-      const ProtocolHandler& handler);
+      const ProtocolHandler& handler,
+      scoped_refptr<ProtocolResponseCache> cache = nullptr);
 
   // network::mojom::URLLoaderFactory:
   void CreateLoaderAndStart(
@@ -128,8 +134,15 @@ class ElectronURLLoaderFactory : public network::SelfDeletingURLLoaderFactory {
       const net::MutableNetworkTrafficAnnotationTag& traffic_annotation,
       mojo::PendingRemote<network::mojom::URLLoaderFactory> target_factory,
       ProtocolType type,
+      scoped_refptr<ProtocolResponseCache> cache,
       gin::Arguments* args);
 
+  // Writes |data| to |client| as the body of |head| and completes the request.
+  static void SendBody(
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      network::mojom::URLResponseHeadPtr head,
+      scoped_refptr<base::RefCountedMemory> data);
+
   // disable copy
   ElectronURLLoaderFactory(const ElectronURLLoaderFactory&) = delete;
   ElectronURLLoaderFactory& operator=(const ElectronURLLoaderFactory&) = delete;
@@ -138,9 +151,32 @@ class ElectronURLLoaderFactory : public network::SelfDeletingURLLoaderFactory {
   ElectronURLLoaderFactory(
       ProtocolType type,
       const ProtocolHandler& handler,
+      scoped_refptr<ProtocolResponseCache> cache,
       mojo::PendingReceiver<network::mojom::URLLoaderFactory> factory_receiver);
   ~ElectronURLLoaderFactory() override;
 
+  // Runs the handler through |factory|, or aborts the request when the
+  // factory went away while the cache was being looked up.
+  static void RunHandlerIfAlive(
+      base::WeakPtr<ElectronURLLoaderFactory> factory,
+      mojo::PendingReceiver<network::mojom::URLLoader> loader,
+      int32_t request_id,
+      uint32_t options,
+      const network::ResourceRequest& request,
+      const net::MutableNetworkTrafficAnnotationTag& traffic_annotation,
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      const network::ResourceRequest& handler_request);
+
+  // Passes |handler_request| to the protocol handler.
+  void RunHandler(
+      mojo::PendingReceiver<network::mojom::URLLoader> loader,
+      int32_t request_id,
+      uint32_t options,
+      const network::ResourceRequest& request,
+      const net::MutableNetworkTrafficAnnotationTag& traffic_annotation,
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      const network::ResourceRequest& handler_request);
+
   static void OnComplete(
       mojo::PendingRemote<network::mojom::URLLoaderClient> client,
       int32_t request_id,
@@ -149,7 +185,8 @@ class ElectronURLLoaderFactory : public network::SelfDeletingURLLoaderFactory {
   static void StartLoadingBuffer(
       mojo::PendingRemote<network::mojom::URLLoaderClient> client,
       network::mojom::URLResponseHeadPtr head,
-      v8::Local<v8::ArrayBufferView> buffer);
+      v8::Local<v8::ArrayBufferView> buffer,
+      ResponseRecorder recorder);
   static void StartLoadingFile(
       mojo::PendingRemote<network::mojom::URLLoaderClient> client,
       mojo::PendingReceiver<network::mojom::URLLoader> loader,
@@ -167,16 +204,27 @@ class ElectronURLLoaderFactory : public network::SelfDeletingURLLoaderFactory {
       mojo::PendingRemote<network::mojom::URLLoaderClient> client,
       mojo::PendingReceiver<network::mojom::URLLoader> loader,
       network::mojom::URLResponseHeadPtr head,
-      const gin_helper::Dictionary& dict);
+      const gin_helper::Dictionary& dict,
+      ResponseRecorder recorder,
+      size_t max_recorded_size);
 
-  // Helper to send string as response.
+  // Helpers to send a complete body as response.
   static void SendContents(
       mojo::PendingRemote<network::mojom::URLLoaderClient> client,
       network::mojom::URLResponseHeadPtr head,
-      std::string data);
+      std::string data,
+      ResponseRecorder recorder = {});
+  static void SendContents(
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      network::mojom::URLResponseHeadPtr head,
+      scoped_refptr<base::RefCountedMemory> data,
+      ResponseRecorder recorder = {});
 
   ProtocolType type_;
   ProtocolHandler handler_;
+  scoped_refptr<ProtocolResponseCache> cache_;
+
+  base::WeakPtrFactory<ElectronURLLoaderFactory> weak_factory_{this};
 };
 
 }  // namespace electron
@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/net/host_prefetcher.h"
+
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/task/sequenced_task_runner.h"
+#include "net/base/address_list.h"
+#include "services/network/public/mojom/host_resolver.mojom.h"
+#include "shell/browser/net/resolve_host_function.h"
+
+namespace electron {
+
+namespace {
+
+// Number of hosts that are resolved at once.
+constexpr size_t kMaxConcurrentLookups = 6;
+
+}  // namespace
+
+HostPrefetcher::Batch::Batch() = default;
+HostPrefetcher::Batch::Batch(Batch&&) = default;
+HostPrefetcher::Batch::~Batch() = default;
+
+HostPrefetcher::HostPrefetcher(ElectronBrowserContext* browser_context)
+    : browser_context_(browser_context) {}
+
+HostPrefetcher::~HostPrefetcher() = default;
+
+void HostPrefetcher::Prefetch(const std::vector<std::string>& hosts,
+                              net::RequestPriority priority,
+                              Callback callback) {
+  if (hosts.empty()) {
+    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+        FROM_HERE, base::BindOnce(std::move(callback), std::vector<Result>()));
+    return;
+  }
+
+  const uint64_t batch_id = next_batch_id_++;
+  Batch& batch = batches_[batch_id];
+  batch.callback = std::move(callback);
+  batch.results.resize(hosts.size());
+  batch.remaining = hosts.size();
+
+  for (size_t i = 0; i < hosts.size(); ++i) {
+    batch.results[i].host = hosts[i];
+    auto& waiters = waiters_[hosts[i]];
+    // Hosts without waiters are neither queued nor being resolved yet.
+    if (waiters.empty())
+      pending_hosts_.emplace_back(hosts[i], priority);
+    waiters.emplace_back(batch_id, i);
+  }
+
+  StartPendingLookups();
+}
+
+void HostPrefetcher::StartPendingLookups() {
+  while (!pending_hosts_.empty() && active_lookups_ < kMaxConcurrentLookups) {
+    auto [host, priority] = std::move(pending_hosts_.front());
+    pending_hosts_.pop_front();
+    ++active_lookups_;
+
+    auto params = network::mojom::ResolveHostParameters::New();
+    params->initial_priority = priority;
+    params->purpose = network::mojom::ResolveHostParameters::Purpose::kPrefetch;
+    auto fn = base::MakeRefCounted<ResolveHostFunction>(
+        browser_context_, host, std::move(params),
+        base::BindOnce(&HostPrefetcher::OnLookupComplete,
+                       weak_factory_.GetWeakPtr(), host,
+                       base::TimeTicks::Now()));
+    fn->Run();
+  }
+}
+
+void HostPrefetcher::OnLookupComplete(
+    const std::string& host,
+    base::TimeTicks start_time,
+    int64_t net_error,
+    const std::optional<net::AddressList>& addresses) {
+  --active_lookups_;
+  const base::TimeDelta duration = base::TimeTicks::Now() - start_time;
+
+  auto waiters = std::move(waiters_[host]);
+  waiters_.erase(host);
+  for (const auto& [batch_id, index] : waiters) {
+    auto iter = batches_.find(batch_id);
+    CHECK(iter != batches_.end());
+    Batch& batch = iter->second;
+    batch.results[index].net_error = static_cast<int>(net_error);
+    batch.results[index].duration = duration;
+    if (--batch.remaining == 0) {
+      Batch completed_batch = std::move(batch);
+      batches_.erase(iter);
+      std::move(completed_batch.callback)
+          .Run(std::move(completed_batch.results));
+    }
+  }
+
+  StartPendingLookups();
+}
+
+}  // namespace electron
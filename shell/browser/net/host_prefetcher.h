@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_NET_HOST_PREFETCHER_H_
+#define ELECTRON_SHELL_BROWSER_NET_HOST_PREFETCHER_H_
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/circular_deque.h"
+#include "base/functional/callback.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "net/base/request_priority.h"
+
+namespace net {
+class AddressList;
+}  // namespace net
+
+namespace electron {
+
+class ElectronBrowserContext;
+
+// Resolves batches of hosts ahead of use so that they end up in the host
+// cache of the network service. A few hosts are resolved at once, and hosts
+// that are already being resolved, for this or another batch, are not
+// resolved again.
+class HostPrefetcher {
+ public:
+  struct Result {
+    std::string host;
+    int net_error = 0;
+    // Time taken to resolve the host, not counting the time spent queued.
+    base::TimeDelta duration;
+  };
+
+  using Callback = base::OnceCallback<void(std::vector<Result>)>;
+
+  explicit HostPrefetcher(ElectronBrowserContext* browser_context);
+  ~HostPrefetcher();
+
+  // disable copy
+  HostPrefetcher(const HostPrefetcher&) = delete;
+  HostPrefetcher& operator=(const HostPrefetcher&) = delete;
+
+  // Resolves |hosts| and runs |callback| with a result per host, in the same
+  // order, once all of them are resolved.
+  void Prefetch(const std::vector<std::string>& hosts,
+                net::RequestPriority priority,
+                Callback callback);
+
+ private:
+  struct Batch {
+    Batch();
+    Batch(Batch&&);
+    ~Batch();
+
+    std::vector<Result> results;
+    size_t remaining = 0;
+    Callback callback;
+  };
+
+  void StartPendingLookups();
+  void OnLookupComplete(const std::string& host,
+                        base::TimeTicks start_time,
+                        int64_t net_error,
+                        const std::optional<net::AddressList>& addresses);
+
+  // Weak Ref
+  raw_ptr<ElectronBrowserContext> browser_context_;
+
+  // Hosts waiting for a lookup slot, with the priority to resolve them at.
+  base::circular_deque<std::pair<std::string, net::RequestPriority>>
+      pending_hosts_;
+  size_t active_lookups_ = 0;
+
+  // The batches and result indices waiting for each queued or active host.
+  std::map<std::string, std::vector<std::pair<uint64_t, size_t>>> waiters_;
+  std::map<uint64_t, Batch> batches_;
+  uint64_t next_batch_id_ = 0;
+
+  base::WeakPtrFactory<HostPrefetcher> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_NET_HOST_PREFETCHER_H_
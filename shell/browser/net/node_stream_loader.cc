@@ -7,7 +7,9 @@
 #include <string_view>
 #include <utility>
 
+#include "base/memory/ref_counted_memory.h"
 #include "mojo/public/cpp/system/string_data_source.h"
+#include "services/network/public/cpp/features.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/node_includes.h"
 
@@ -18,11 +20,15 @@ NodeStreamLoader::NodeStreamLoader(
     mojo::PendingReceiver<network::mojom::URLLoader> loader,
     mojo::PendingRemote<network::mojom::URLLoaderClient> client,
     v8::Isolate* isolate,
-    v8::Local<v8::Object> emitter)
+    v8::Local<v8::Object> emitter,
+    ResponseRecorder recorder,
+    size_t max_recorded_size)
     : url_loader_(this, std::move(loader)),
       client_(std::move(client)),
       isolate_(isolate),
-      emitter_(isolate, emitter) {
+      emitter_(isolate, emitter),
+      recorder_(std::move(recorder)),
+      max_recorded_size_(max_recorded_size) {
   url_loader_.set_disconnect_handler(
       base::BindOnce(&NodeStreamLoader::NotifyComplete,
                      weak_factory_.GetWeakPtr(), net::ERR_FAILED));
@@ -50,15 +56,22 @@ NodeStreamLoader::~NodeStreamLoader() {
 }
 
 void NodeStreamLoader::Start(network::mojom::URLResponseHeadPtr head) {
+  // Use a large pipe so that a whole chunk usually fits in, and the next
+  // one can be read while it is consumed.
   mojo::ScopedDataPipeProducerHandle producer;
   mojo::ScopedDataPipeConsumerHandle consumer;
-  MojoResult rv = mojo::CreateDataPipe(nullptr, producer, consumer);
+  MojoResult rv = mojo::CreateDataPipe(
+      network::features::GetDataPipeDefaultAllocationSize(
+          network::features::DataPipeAllocationSize::kLargerSizeIfPossible),
+      producer, consumer);
   if (rv != MOJO_RESULT_OK) {
     NotifyComplete(net::ERR_INSUFFICIENT_RESOURCES);
     return;
   }
 
   producer_ = std::make_unique<mojo::DataPipeProducer>(std::move(producer));
+  if (recorder_)
+    recorded_head_ = head.Clone();
   client_->OnReceiveResponse(std::move(head), std::move(consumer),
                              std::nullopt);
 
@@ -94,6 +107,12 @@ void NodeStreamLoader::NotifyComplete(int result) {
     return;
   }
 
+  if (recorder_ && result == net::OK) {
+    std::move(recorder_).Run(std::move(recorded_head_),
+                             base::MakeRefCounted<base::RefCountedString>(
+                                 std::move(recorded_body_)));
+  }
+
   network::URLLoaderCompletionStatus status(result);
   status.completion_time = base::TimeTicks::Now();
   status.decoded_body_length = bytes_written_;
@@ -108,6 +127,9 @@ void NodeStreamLoader::ReadMore() {
     // a nested read, so short-circuit.
     return;
   }
+  // Both the chunk being written and the one read ahead are taken.
+  if (is_writing_ && !next_buffer_.IsEmpty())
+    return;
   is_reading_ = true;
   auto weak = weak_factory_.GetWeakPtr();
   v8::HandleScope scope(isolate_);
@@ -135,34 +157,83 @@ void NodeStreamLoader::ReadMore() {
     return;
   }
 
+  is_reading_ = false;
+  if (is_writing_) {
+    // Hold the chunk until the current write is done.
+    next_buffer_.Reset(isolate_, buffer);
+    return;
+  }
+
+  Write(buffer);
+
+  // Read the next chunk while this one is being written.
+  ReadMore();
+}
+
+void NodeStreamLoader::Write(v8::Local<v8::Value> buffer) {
   // Hold the buffer until the write is done.
   buffer_.Reset(isolate_, buffer);
 
   bytes_written_ += node::Buffer::Length(buffer);
 
+  if (recorder_) {
+    if (bytes_written_ <= max_recorded_size_) {
+      recorded_body_.append(node::Buffer::Data(buffer),
+                            node::Buffer::Length(buffer));
+    } else {
+      // Too large to be cached, stop collecting.
+      recorder_.Reset();
+      recorded_body_.clear();
+    }
+  }
+
   // Write buffer to mojo pipe asynchronously.
-  is_reading_ = false;
   is_writing_ = true;
   producer_->Write(std::make_unique<mojo::StringDataSource>(
                        std::string_view{node::Buffer::Data(buffer),
                                         node::Buffer::Length(buffer)},
                        mojo::StringDataSource::AsyncWritingMode::
                            STRING_STAYS_VALID_UNTIL_COMPLETION),
-                   base::BindOnce(&NodeStreamLoader::DidWrite, weak));
+                   base::BindOnce(&NodeStreamLoader::DidWrite,
+                                  weak_factory_.GetWeakPtr()));
 }
 
 void NodeStreamLoader::DidWrite(MojoResult result) {
   is_writing_ = false;
+  buffer_.Reset();
+
+  if (result != MOJO_RESULT_OK) {
+    next_buffer_.Reset();
+    NotifyComplete(net::ERR_FAILED);
+    return;
+  }
+
+  // We were told to end streaming because of an error.
+  if (pending_result_ && result_ != net::OK) {
+    next_buffer_.Reset();
+    NotifyComplete(result_);
+    return;
+  }
+
+  // Write the chunk that was read ahead, even when the stream has ended.
+  if (!next_buffer_.IsEmpty()) {
+    v8::HandleScope scope(isolate_);
+    v8::Local<v8::Value> next = next_buffer_.Get(isolate_);
+    next_buffer_.Reset();
+    Write(next);
+    if (!pending_result_ && readable_)
+      ReadMore();
+    return;
+  }
+
   // We were told to end streaming.
   if (pending_result_) {
     NotifyComplete(result_);
     return;
   }
 
-  if (result == MOJO_RESULT_OK && readable_)
+  if (readable_)
     ReadMore();
-  else
-    NotifyComplete(net::ERR_FAILED);
 }
 
 void NodeStreamLoader::On(const char* event, EventCallback callback) {
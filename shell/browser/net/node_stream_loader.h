@@ -15,6 +15,7 @@
 #include "mojo/public/cpp/bindings/remote.h"
 #include "services/network/public/mojom/url_loader.mojom.h"
 #include "services/network/public/mojom/url_response_head.mojom.h"
+#include "shell/browser/net/protocol_response_cache.h"
 #include "v8/include/v8-forward.h"
 #include "v8/include/v8-object.h"
 #include "v8/include/v8-persistent-handle.h"
@@ -36,14 +37,21 @@ namespace electron {
 //
 // We use |paused mode| to read data from |Readable| stream, so we don't need to
 // copy data from buffer and hold it in memory, and we only need to make sure
-// the passed |Buffer| is alive while writing data to pipe.
+// the passed |Buffer| is alive while writing data to pipe. One chunk is read
+// ahead while the previous one is being written, so that JS can produce data
+// while the pipe is drained.
+//
+// When |recorder| is set, the streamed body is also collected and passed to it
+// once the stream ends, unless it grows beyond |max_recorded_size|.
 class NodeStreamLoader : public network::mojom::URLLoader {
  public:
   NodeStreamLoader(network::mojom::URLResponseHeadPtr head,
                    mojo::PendingReceiver<network::mojom::URLLoader> loader,
                    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
                    v8::Isolate* isolate,
-                   v8::Local<v8::Object> emitter);
+                   v8::Local<v8::Object> emitter,
+                   ResponseRecorder recorder = {},
+                   size_t max_recorded_size = 0);
 
   // disable copy
   NodeStreamLoader(const NodeStreamLoader&) = delete;
@@ -60,6 +68,7 @@ class NodeStreamLoader : public network::mojom::URLLoader {
   void NotifyReadable();
   void NotifyComplete(int result);
   void ReadMore();
+  void Write(v8::Local<v8::Value> buffer);
   void DidWrite(MojoResult result);
 
   // Subscribe to events of |emitter|.
@@ -79,7 +88,9 @@ class NodeStreamLoader : public network::mojom::URLLoader {
 
   raw_ptr<v8::Isolate> isolate_;
   v8::Global<v8::Object> emitter_;
+  // The chunk being written, and the one read ahead while it is.
   v8::Global<v8::Value> buffer_;
+  v8::Global<v8::Value> next_buffer_;
 
   // Mojo data pipe where the data that is being read is written to.
   std::unique_ptr<mojo::DataPipeProducer> producer_;
@@ -111,6 +122,11 @@ class NodeStreamLoader : public network::mojom::URLLoader {
   // that occurred in a flag.
   bool has_read_waiting_ = false;
 
+  ResponseRecorder recorder_;
+  network::mojom::URLResponseHeadPtr recorded_head_;
+  std::string recorded_body_;
+  const size_t max_recorded_size_;
+
   // Store the V8 callbacks to unsubscribe them later.
   std::map<std::string, v8::Global<v8::Value>> handlers_;
 
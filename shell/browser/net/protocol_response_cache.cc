@@ -0,0 +1,431 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/net/protocol_response_cache.h"
+
+#include <iterator>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/hash/hash.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/json/values_util.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
+#include "base/values.h"
+#include "net/base/load_flags.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_status_code.h"
+#include "net/http/http_util.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/mojom/url_loader.mojom.h"
+#include "shell/browser/net/electron_url_loader_factory.h"
+
+namespace electron {
+
+namespace {
+
+constexpr std::string_view kBodyExtension = ".body";
+constexpr std::string_view kMetadataExtension = ".json";
+
+std::string GetKey(const network::ResourceRequest& request) {
+  return request.method + ' ' + request.url.GetWithoutRef().spec();
+}
+
+// Requests that the page made conditional or partial itself, or that asked
+// to skip the cache, always go to the handler.
+bool IsCacheableRequest(const network::ResourceRequest& request) {
+  return request.method == net::HttpRequestHeaders::kGetMethod &&
+         !(request.load_flags &
+           (net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE)) &&
+         !request.headers.HasHeader(net::HttpRequestHeaders::kRange) &&
+         !request.headers.HasHeader(net::HttpRequestHeaders::kIfNoneMatch) &&
+         !request.headers.HasHeader(
+             net::HttpRequestHeaders::kIfModifiedSince);
+}
+
+// Returns the values of the request headers that |headers| varies on, or
+// nullopt if the response varies on everything.
+std::optional<base::flat_map<std::string, std::string>> GetVaryValues(
+    const network::ResourceRequest& request,
+    const net::HttpResponseHeaders& headers) {
+  base::flat_map<std::string, std::string> values;
+  const std::optional<std::string> vary = headers.GetNormalizedHeader("vary");
+  if (!vary)
+    return values;
+  for (const auto name : base::SplitStringPiece(
+           *vary, ",", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    if (name == "*")
+      return std::nullopt;
+    values[base::ToLowerASCII(name)] =
+        request.headers.GetHeader(name).value_or(std::string());
+  }
+  return values;
+}
+
+}  // namespace
+
+// Persists entries on a thread pool sequence. Each entry is stored as a JSON
+// metadata file next to a file holding the raw body, both named after a hash
+// of the key; the key is kept in the metadata to detect collisions.
+class ProtocolResponseCache::DiskStore {
+ public:
+  struct Record {
+    base::Value::Dict metadata;
+    scoped_refptr<base::RefCountedMemory> body;
+  };
+
+  explicit DiskStore(const base::FilePath& path) : path_(path) {}
+
+  // disable copy
+  DiskStore(const DiskStore&) = delete;
+  DiskStore& operator=(const DiskStore&) = delete;
+
+  std::optional<Record> Read(const std::string& key) {
+    std::string metadata_json;
+    if (!base::ReadFileToString(GetPath(key, kMetadataExtension),
+                                &metadata_json)) {
+      return std::nullopt;
+    }
+    std::optional<base::Value::Dict> metadata =
+        base::JSONReader::ReadDict(metadata_json);
+    if (!metadata) {
+      return std::nullopt;
+    }
+    const std::string* stored_key = metadata->FindString("key");
+    if (!stored_key || *stored_key != key) {
+      return std::nullopt;
+    }
+
+    std::string body;
+    if (!base::ReadFileToString(GetPath(key, kBodyExtension), &body)) {
+      return std::nullopt;
+    }
+    return Record{std::move(*metadata),
+                  base::MakeRefCounted<base::RefCountedString>(
+                      std::move(body))};
+  }
+
+  void Write(const std::string& key,
+             base::Value::Dict metadata,
+             scoped_refptr<base::RefCountedMemory> body) {
+    if (!base::CreateDirectory(path_))
+      return;
+    std::optional<std::string> metadata_json = base::WriteJson(metadata);
+    if (!metadata_json)
+      return;
+    // The metadata is written last, and removed before the body is replaced,
+    // so that it is only ever found next to the body it describes.
+    base::DeleteFile(GetPath(key, kMetadataExtension));
+    if (!base::WriteFile(GetPath(key, kBodyExtension), *body))
+      return;
+    base::WriteFile(GetPath(key, kMetadataExtension), *metadata_json);
+  }
+
+  void Delete(const std::string& key) {
+    base::DeleteFile(GetPath(key, kMetadataExtension));
+    base::DeleteFile(GetPath(key, kBodyExtension));
+  }
+
+  void DeleteAll() { base::DeletePathRecursively(path_); }
+
+ private:
+  base::FilePath GetPath(const std::string& key,
+                         std::string_view extension) const {
+    return path_.AppendASCII(
+        base::StrCat({base::NumberToString(base::PersistentHash(key)),
+                      extension}));
+  }
+
+  const base::FilePath path_;
+};
+
+ProtocolResponseCache::Entry::Entry() = default;
+ProtocolResponseCache::Entry::~Entry() = default;
+
+ProtocolResponseCache::ProtocolResponseCache(const Options& options)
+    : options_(options),
+      entries_(decltype(entries_)::NO_AUTO_EVICT) {
+  if (!options_.disk_path.empty()) {
+    disk_store_ = base::SequenceBound<DiskStore>(
+        base::ThreadPool::CreateSequencedTaskRunner(
+            {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+             base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}),
+        options_.disk_path);
+  }
+}
+
+ProtocolResponseCache::~ProtocolResponseCache() = default;
+
+void ProtocolResponseCache::Start(
+    const network::ResourceRequest& request,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    MissCallback on_miss) {
+  if (!IsCacheableRequest(request)) {
+    std::move(on_miss).Run(std::move(client), request);
+    return;
+  }
+
+  const std::string key = GetKey(request);
+  if (auto it = entries_.Get(key); it != entries_.end()) {
+    OnEntryFound(request, std::move(client), std::move(on_miss),
+                 it->second.get());
+    return;
+  }
+
+  if (disk_store_) {
+    disk_store_.AsyncCall(&DiskStore::Read)
+        .WithArgs(key)
+        .Then(base::BindOnce(
+            [](scoped_refptr<ProtocolResponseCache> cache,
+               const network::ResourceRequest& request,
+               mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+               MissCallback on_miss,
+               std::optional<DiskStore::Record> record) {
+              std::unique_ptr<Entry> entry;
+              if (record) {
+                const base::Value::Dict& metadata = record->metadata;
+                const std::string* raw_headers =
+                    metadata.FindString("headers");
+                const std::string* mime_type = metadata.FindString("mimeType");
+                const std::string* charset = metadata.FindString("charset");
+                const base::Value::Dict* vary = metadata.FindDict("vary");
+                const std::optional<base::Time> response_time =
+                    base::ValueToTime(metadata.Find("responseTime"));
+                if (raw_headers && mime_type && charset && vary &&
+                    response_time) {
+                  entry = std::make_unique<Entry>();
+                  entry->head = network::mojom::URLResponseHead::New();
+                  entry->head->headers =
+                      base::MakeRefCounted<net::HttpResponseHeaders>(
+                          net::HttpUtil::AssembleRawHeaders(*raw_headers));
+                  entry->head->mime_type = *mime_type;
+                  entry->head->charset = *charset;
+                  entry->head->content_length = record->body->size();
+                  for (const auto [name, value] : *vary) {
+                    if (value.is_string())
+                      entry->vary[name] = value.GetString();
+                  }
+                  entry->body = std::move(record->body);
+                  entry->response_time = *response_time;
+                }
+              }
+              cache->OnDiskRead(request, std::move(client), std::move(on_miss),
+                                std::move(entry));
+            },
+            base::WrapRefCounted(this), request, std::move(client),
+            std::move(on_miss)));
+    return;
+  }
+
+  ++stats_.misses;
+  std::move(on_miss).Run(std::move(client), request);
+}
+
+void ProtocolResponseCache::OnDiskRead(
+    const network::ResourceRequest& request,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    MissCallback on_miss,
+    std::unique_ptr<Entry> entry) {
+  if (!entry) {
+    ++stats_.misses;
+    std::move(on_miss).Run(std::move(client), request);
+    return;
+  }
+
+  // Serve before inserting, as inserting may evict the entry right away. The
+  // handler answers a revalidation asynchronously, after the insertion.
+  OnEntryFound(request, std::move(client), std::move(on_miss), entry.get());
+  Insert(GetKey(request), std::move(entry));
+}
+
+void ProtocolResponseCache::OnEntryFound(
+    const network::ResourceRequest& request,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    MissCallback on_miss,
+    const Entry* entry) {
+  const std::optional<base::flat_map<std::string, std::string>> vary =
+      GetVaryValues(request, *entry->head->headers);
+  if (!vary || *vary != entry->vary) {
+    ++stats_.misses;
+    std::move(on_miss).Run(std::move(client), request);
+    return;
+  }
+
+  if (IsFresh(*entry)) {
+    ++stats_.hits;
+    ElectronURLLoaderFactory::SendBody(std::move(client), entry->head.Clone(),
+                                     entry->body);
+    return;
+  }
+
+  ++stats_.misses;
+  const std::optional<std::string> etag =
+      entry->head->headers->GetNormalizedHeader("etag");
+  if (!etag) {
+    std::move(on_miss).Run(std::move(client), request);
+    return;
+  }
+
+  network::ResourceRequest conditional_request = request;
+  conditional_request.headers.SetHeader(net::HttpRequestHeaders::kIfNoneMatch,
+                                        *etag);
+  std::move(on_miss).Run(std::move(client), conditional_request);
+}
+
+bool ProtocolResponseCache::IsNotModified(
+    const network::ResourceRequest& request,
+    const network::mojom::URLResponseHead& head) const {
+  if (!head.headers || head.headers->response_code() != net::HTTP_NOT_MODIFIED)
+    return false;
+  if (!IsCacheableRequest(request))
+    return false;
+  auto it = entries_.Peek(GetKey(request));
+  return it != entries_.end() &&
+         it->second->head->headers->HasHeader("etag");
+}
+
+void ProtocolResponseCache::ServeNotModified(
+    const network::ResourceRequest& request,
+    const network::mojom::URLResponseHead& head,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client) {
+  auto it = entries_.Get(GetKey(request));
+  CHECK(it != entries_.end());
+  Entry* entry = it->second.get();
+
+  // Refresh the stored headers, and with them the freshness lifetime, from
+  // the 304 as described in RFC 9111 section 4.3.4.
+  entry->head->headers->Update(*head.headers);
+  entry->response_time = base::Time::Now();
+  ElectronURLLoaderFactory::SendBody(std::move(client), entry->head.Clone(),
+                                     entry->body);
+}
+
+ResponseRecorder ProtocolResponseCache::MaybeRecord(
+    const network::ResourceRequest& request,
+    const network::mojom::URLResponseHead& head) {
+  if (!IsCacheableRequest(request) || !head.headers ||
+      head.headers->response_code() != net::HTTP_OK ||
+      head.headers->HasHeaderValue("cache-control", "no-store")) {
+    return {};
+  }
+
+  std::optional<base::flat_map<std::string, std::string>> vary =
+      GetVaryValues(request, *head.headers);
+  if (!vary)
+    return {};
+
+  return base::BindOnce(&ProtocolResponseCache::Store,
+                        base::WrapRefCounted(this), GetKey(request),
+                        std::move(*vary));
+}
+
+void ProtocolResponseCache::Store(
+    const std::string& key,
+    base::flat_map<std::string, std::string> vary,
+    network::mojom::URLResponseHeadPtr head,
+    scoped_refptr<base::RefCountedMemory> body) {
+  if (body->size() > options_.max_entry_size)
+    return;
+
+  auto entry = std::make_unique<Entry>();
+  entry->head = std::move(head);
+  entry->body = std::move(body);
+  entry->vary = std::move(vary);
+  entry->response_time = base::Time::Now();
+
+  // Entries that can be neither served fresh nor revalidated are useless.
+  if (!IsFresh(*entry) && !entry->head->headers->HasHeader("etag"))
+    return;
+
+  if (disk_store_) {
+    base::Value::Dict vary_dict;
+    for (const auto& [name, value] : entry->vary)
+      vary_dict.Set(name, value);
+    auto metadata =
+        base::Value::Dict()
+            .Set("key", key)
+            .Set("headers", net::HttpUtil::ConvertHeadersBackToHTTPResponse(
+                                entry->head->headers->raw_headers()))
+            .Set("mimeType", entry->head->mime_type)
+            .Set("charset", entry->head->charset)
+            .Set("vary", std::move(vary_dict))
+            .Set("responseTime", base::TimeToValue(entry->response_time));
+    disk_store_.AsyncCall(&DiskStore::Write)
+        .WithArgs(key, std::move(metadata), entry->body);
+  }
+
+  Insert(key, std::move(entry));
+}
+
+void ProtocolResponseCache::Insert(const std::string& key,
+                                   std::unique_ptr<Entry> entry) {
+  if (auto it = entries_.Peek(key); it != entries_.end()) {
+    size_ -= it->second->body->size();
+    entries_.Erase(it);
+  }
+  size_ += entry->body->size();
+  entries_.Put(key, std::move(entry));
+  EvictIfNeeded();
+}
+
+void ProtocolResponseCache::EvictIfNeeded() {
+  while (size_ > options_.max_size && !entries_.empty()) {
+    auto it = std::prev(entries_.end());
+    size_ -= it->second->body->size();
+    entries_.Erase(it);
+    ++stats_.evictions;
+  }
+}
+
+void ProtocolResponseCache::Invalidate(const GURL& url) {
+  if (url.is_empty()) {
+    entries_.Clear();
+    size_ = 0;
+    if (disk_store_)
+      disk_store_.AsyncCall(&DiskStore::DeleteAll);
+    return;
+  }
+
+  network::ResourceRequest request;
+  request.url = url;
+  const std::string key = GetKey(request);
+  if (auto it = entries_.Peek(key); it != entries_.end()) {
+    size_ -= it->second->body->size();
+    entries_.Erase(it);
+  }
+  if (disk_store_)
+    disk_store_.AsyncCall(&DiskStore::Delete).WithArgs(key);
+}
+
+ProtocolResponseCache::Stats ProtocolResponseCache::GetStats() const {
+  Stats stats = stats_;
+  stats.entry_count = entries_.size();
+  stats.size = size_;
+  return stats;
+}
+
+bool ProtocolResponseCache::IsFresh(const Entry& entry) const {
+  const net::HttpResponseHeaders& headers = *entry.head->headers;
+  base::TimeDelta freshness;
+  if (headers.HasHeaderValue("cache-control", "no-cache")) {
+    freshness = base::TimeDelta();
+  } else if (!headers.HasHeader("cache-control") &&
+             !headers.HasHeader("expires")) {
+    freshness = options_.default_max_age;
+  } else {
+    freshness = headers.GetFreshnessLifetimes(entry.response_time).freshness;
+  }
+  return base::Time::Now() - entry.response_time < freshness;
+}
+
+}  // namespace electron
@@ -0,0 +1,152 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_NET_PROTOCOL_RESPONSE_CACHE_H_
+#define ELECTRON_SHELL_BROWSER_NET_PROTOCOL_RESPONSE_CACHE_H_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "base/containers/flat_map.h"
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/threading/sequence_bound.h"
+#include "base/time/time.h"
+#include "mojo/public/cpp/bindings/pending_remote.h"
+#include "services/network/public/mojom/url_loader.mojom-forward.h"
+#include "services/network/public/mojom/url_response_head.mojom.h"
+
+class GURL;
+
+namespace network {
+struct ResourceRequest;
+}  // namespace network
+
+namespace electron {
+
+// Receives the head and the complete body of a response once it is known, so
+// that it can be stored in a ProtocolResponseCache.
+using ResponseRecorder =
+    base::OnceCallback<void(network::mojom::URLResponseHeadPtr head,
+                            scoped_refptr<base::RefCountedMemory> body)>;
+
+// Opt-in cache for the responses of a custom protocol handler, keyed by
+// method and URL and matched against the response's Vary header. Fresh hits
+// are written to the data pipe from here without calling into JS; stale
+// entries with an ETag are revalidated by passing If-None-Match to the
+// handler. Entries live in memory and, when a directory is configured, are
+// also written through to disk. Lives on the UI thread.
+class ProtocolResponseCache
+    : public base::RefCounted<ProtocolResponseCache> {
+ public:
+  struct Options {
+    // Limits for the in-memory tier, in bytes of body data.
+    size_t max_size = 64 * 1024 * 1024;
+    size_t max_entry_size = 8 * 1024 * 1024;
+    // Freshness of responses that have neither Cache-Control nor Expires.
+    base::TimeDelta default_max_age;
+    // When set, entries are also persisted in this directory.
+    base::FilePath disk_path;
+  };
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entry_count = 0;
+    size_t size = 0;
+  };
+
+  // Runs the protocol handler for a request that couldn't be served from the
+  // cache. |handler_request| may carry an added If-None-Match header.
+  using MissCallback = base::OnceCallback<void(
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      const network::ResourceRequest& handler_request)>;
+
+  explicit ProtocolResponseCache(const Options& options);
+
+  // disable copy
+  ProtocolResponseCache(const ProtocolResponseCache&) = delete;
+  ProtocolResponseCache& operator=(const ProtocolResponseCache&) = delete;
+
+  // Serves |request| from the cache when a fresh entry exists and runs
+  // |on_miss| otherwise.
+  void Start(const network::ResourceRequest& request,
+             mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+             MissCallback on_miss);
+
+  // Whether |head| is the handler's 304 answer to a revalidation started by
+  // Start(), in which case ServeNotModified() should be used.
+  bool IsNotModified(const network::ResourceRequest& request,
+                     const network::mojom::URLResponseHead& head) const;
+  void ServeNotModified(
+      const network::ResourceRequest& request,
+      const network::mojom::URLResponseHead& head,
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client);
+
+  // Returns a recorder that stores the handler's response to |request|, or a
+  // null callback when |head| must not be cached.
+  ResponseRecorder MaybeRecord(const network::ResourceRequest& request,
+                               const network::mojom::URLResponseHead& head);
+
+  // Drops the entry for |url|, or all entries when |url| is empty.
+  void Invalidate(const GURL& url);
+
+  Stats GetStats() const;
+
+  size_t max_entry_size() const { return options_.max_entry_size; }
+
+ private:
+  friend class base::RefCounted<ProtocolResponseCache>;
+
+  class DiskStore;
+
+  struct Entry {
+    Entry();
+    ~Entry();
+
+    network::mojom::URLResponseHeadPtr head;
+    scoped_refptr<base::RefCountedMemory> body;
+    // Values of the request headers named by the response's Vary header.
+    base::flat_map<std::string, std::string> vary;
+    base::Time response_time;
+  };
+
+  ~ProtocolResponseCache();
+
+  void OnEntryFound(const network::ResourceRequest& request,
+                    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+                    MissCallback on_miss,
+                    const Entry* entry);
+  void OnDiskRead(const network::ResourceRequest& request,
+                  mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+                  MissCallback on_miss,
+                  std::unique_ptr<Entry> entry);
+
+  void Store(const std::string& key,
+             base::flat_map<std::string, std::string> vary,
+             network::mojom::URLResponseHeadPtr head,
+             scoped_refptr<base::RefCountedMemory> body);
+  void Insert(const std::string& key, std::unique_ptr<Entry> entry);
+  void EvictIfNeeded();
+
+  bool IsFresh(const Entry& entry) const;
+
+  const Options options_;
+
+  base::LRUCache<std::string, std::unique_ptr<Entry>> entries_;
+  size_t size_ = 0;
+  Stats stats_;
+
+  base::SequenceBound<DiskStore> disk_store_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_NET_PROTOCOL_RESPONSE_CACHE_H_
@@ -808,7 +808,8 @@ void ProxyingURLLoaderFactory::CreateLoaderAndStart(
           base::BindOnce(&ElectronURLLoaderFactory::StartLoading,
                          std::move(loader), request_id, options, request,
                          std::move(client), traffic_annotation,
-                         std::move(loader_remote), it->second.first));
+                         std::move(loader_remote), it->second.first,
+                         /*cache=*/nullptr));
       return;
     }
   }
@@ -4,12 +4,17 @@
 
 #include "shell/browser/net/resolve_proxy_helper.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "base/functional/bind.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/task/sequenced_task_runner.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/storage_partition.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
+#include "net/base/net_errors.h"
 #include "net/base/network_anonymization_key.h"
 #include "net/proxy_resolution/proxy_info.h"
 #include "services/network/public/mojom/network_context.mojom.h"
@@ -20,13 +25,48 @@ using content::BrowserThread;
 
 namespace electron {
 
+namespace {
+
+// Number of proxy lookups that may be in progress at once.
+constexpr size_t kMaxConcurrentLookups = 8;
+
+// How long resolved proxies are reused for.
+constexpr base::TimeDelta kCacheTTL = base::Seconds(5);
+
+// Expired cache entries are purged once there are this many.
+constexpr size_t kCachePurgeSize = 256;
+
+// PAC scripts only get to see the scheme, host and port of https and wss
+// URLs, but see the path and query of other URLs.
+std::string GetCacheKey(const GURL& url) {
+  if (!url.is_valid())
+    return url.possibly_invalid_spec();
+  if (!url.SchemeIsCryptographic()) {
+    GURL::Replacements replacements;
+    replacements.ClearUsername();
+    replacements.ClearPassword();
+    replacements.ClearRef();
+    return url.ReplaceComponents(replacements).spec();
+  }
+  return base::StrCat({url.scheme(), "://", url.host(), ":",
+                       base::NumberToString(url.EffectiveIntPort())});
+}
+
+}  // namespace
+
 ResolveProxyHelper::ResolveProxyHelper(ElectronBrowserContext* browser_context)
-    : browser_context_(browser_context) {}
+    : browser_context_(browser_context) {
+  receivers_.set_disconnect_handler(base::BindRepeating(
+      [](ResolveProxyHelper* self) {
+        // Copy the key, the context goes away with the receiver.
+        const std::string key = self->receivers_.current_context();
+        self->CompleteLookup(key, std::string(), /*cache=*/false);
+      },
+      base::Unretained(this)));
+}
 
 ResolveProxyHelper::~ResolveProxyHelper() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!owned_self_);
-  DCHECK(!receiver_.is_bound());
   // Clear all pending requests if the ProxyService is still alive.
   pending_requests_.clear();
 }
@@ -34,27 +74,68 @@ ResolveProxyHelper::~ResolveProxyHelper() {
 void ResolveProxyHelper::ResolveProxy(const GURL& url,
                                       ResolveProxyCallback callback) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  // Enqueue the pending request.
-  pending_requests_.emplace_back(url, std::move(callback));
+  PendingRequest request(url, std::move(callback));
+  if (MaybeServeRequest(GetCacheKey(url), request))
+    return;
 
-  // If nothing is in progress, start.
-  if (!receiver_.is_bound()) {
-    DCHECK_EQ(1u, pending_requests_.size());
-    StartPendingRequest();
-  }
+  // Enqueue the pending request, and start it if there's a free slot.
+  pending_requests_.push_back(std::move(request));
+  StartPendingRequests();
+}
+
+void ResolveProxyHelper::InvalidateCache() {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  cache_.clear();
+  ++cache_generation_;
+}
+
+base::OnceClosure ResolveProxyHelper::InvalidateCacheAndRun(
+    base::OnceClosure callback) {
+  return base::BindOnce(
+      [](scoped_refptr<ResolveProxyHelper> self, base::OnceClosure callback) {
+        self->InvalidateCache();
+        std::move(callback).Run();
+      },
+      base::WrapRefCounted(this), std::move(callback));
+}
+
+ResolveProxyHelper::Stats ResolveProxyHelper::GetStats() const {
+  Stats stats;
+  stats.queue_depth = pending_requests_.size();
+  stats.active_lookups = lookups_.size();
+  stats.cache_hits = cache_hits_;
+  stats.lookups = completed_lookups_;
+  if (completed_lookups_)
+    stats.average_latency = total_latency_ / completed_lookups_;
+  stats.max_latency = max_latency_;
+  return stats;
 }
 
-void ResolveProxyHelper::StartPendingRequest() {
+void ResolveProxyHelper::StartPendingRequests() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!receiver_.is_bound());
-  DCHECK(!pending_requests_.empty());
-
-  // Start the request.
-  mojo::PendingRemote<network::mojom::ProxyLookupClient> proxy_lookup_client =
-      receiver_.BindNewPipeAndPassRemote();
-  receiver_.set_disconnect_handler(
-      base::BindOnce(&ResolveProxyHelper::OnProxyLookupComplete,
-                     base::Unretained(this), net::ERR_ABORTED, std::nullopt));
+  while (!pending_requests_.empty()) {
+    PendingRequest& request = pending_requests_.front();
+    // An earlier request may have started a lookup for the same key by now.
+    const std::string key = GetCacheKey(request.url);
+    if (!MaybeServeRequest(key, request)) {
+      if (lookups_.size() >= kMaxConcurrentLookups)
+        return;
+      StartLookup(key, request.url);
+      MaybeServeRequest(key, request);
+    }
+    pending_requests_.pop_front();
+  }
+}
+
+void ResolveProxyHelper::StartLookup(const std::string& key, const GURL& url) {
+  DCHECK(!lookups_.contains(key));
+  Lookup& lookup = lookups_[key];
+  lookup.start_time = base::TimeTicks::Now();
+  lookup.cache_generation = cache_generation_;
+
+  mojo::PendingRemote<network::mojom::ProxyLookupClient> proxy_lookup_client;
+  receivers_.Add(this, proxy_lookup_client.InitWithNewPipeAndPassReceiver(),
+                 key);
   network::mojom::NetworkContext* network_context = nullptr;
   if (browser_context_) {
     network_context =
@@ -64,35 +145,85 @@ void ResolveProxyHelper::StartPendingRequest() {
     network_context = SystemNetworkContextManager::GetInstance()->GetContext();
   }
   CHECK(network_context);
-  network_context->LookUpProxyForURL(pending_requests_.front().url,
-                                     net::NetworkAnonymizationKey(),
+  network_context->LookUpProxyForURL(url, net::NetworkAnonymizationKey(),
                                      std::move(proxy_lookup_client));
 }
 
+bool ResolveProxyHelper::MaybeServeRequest(const std::string& key,
+                                           PendingRequest& request) {
+  if (auto iter = cache_.find(key); iter != cache_.end()) {
+    if (iter->second.expiry > base::TimeTicks::Now()) {
+      ++cache_hits_;
+      // Answer asynchronously, as if a lookup had been made.
+      if (!request.callback.is_null()) {
+        base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+            FROM_HERE,
+            base::BindOnce(std::move(request.callback), iter->second.proxy));
+      }
+      return true;
+    }
+    cache_.erase(iter);
+  }
+
+  if (auto iter = lookups_.find(key); iter != lookups_.end()) {
+    iter->second.callbacks.push_back(std::move(request.callback));
+    return true;
+  }
+  return false;
+}
+
 void ResolveProxyHelper::OnProxyLookupComplete(
     int32_t net_error,
     const std::optional<net::ProxyInfo>& proxy_info) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
-  DCHECK(!pending_requests_.empty());
-
-  receiver_.reset();
-
-  // Clear the current (completed) request.
-  PendingRequest completed_request = std::move(pending_requests_.front());
-  pending_requests_.pop_front();
+  const std::string key = receivers_.current_context();
+  receivers_.Remove(receivers_.current_receiver());
 
   std::string proxy;
   if (proxy_info)
     proxy = proxy_info->ToPacString();
 
-  if (!completed_request.callback.is_null())
-    std::move(completed_request.callback).Run(proxy);
+  CompleteLookup(key, std::move(proxy), net_error == net::OK);
+}
+
+void ResolveProxyHelper::CompleteLookup(const std::string& key,
+                                        std::string proxy,
+                                        bool cache) {
+  auto iter = lookups_.find(key);
+  CHECK(iter != lookups_.end());
+  Lookup completed_lookup = std::move(iter->second);
+  lookups_.erase(iter);
+
+  const base::TimeTicks now = base::TimeTicks::Now();
+  const base::TimeDelta latency = now - completed_lookup.start_time;
+  ++completed_lookups_;
+  total_latency_ += latency;
+  max_latency_ = std::max(max_latency_, latency);
+
+  // Results of lookups that started before the proxy configuration changed
+  // are passed on, but not reused.
+  if (cache && completed_lookup.cache_generation == cache_generation_) {
+    if (cache_.size() >= kCachePurgeSize) {
+      std::erase_if(cache_, [now](const auto& entry) {
+        return entry.second.expiry <= now;
+      });
+    }
+    cache_[key] = {proxy, now + kCacheTTL};
+  }
+
+  for (auto& callback : completed_lookup.callbacks) {
+    if (!callback.is_null())
+      std::move(callback).Run(proxy);
+  }
 
-  // Start the next request.
-  if (!pending_requests_.empty())
-    StartPendingRequest();
+  // Start the requests that were waiting for a free slot.
+  StartPendingRequests();
 }
 
+ResolveProxyHelper::Lookup::Lookup() = default;
+ResolveProxyHelper::Lookup::Lookup(Lookup&&) = default;
+ResolveProxyHelper::Lookup::~Lookup() = default;
+
 ResolveProxyHelper::PendingRequest::PendingRequest(
     const GURL& url,
     ResolveProxyCallback callback)
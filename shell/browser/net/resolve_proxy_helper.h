@@ -5,13 +5,16 @@
 #ifndef ELECTRON_SHELL_BROWSER_NET_RESOLVE_PROXY_HELPER_H_
 #define ELECTRON_SHELL_BROWSER_NET_RESOLVE_PROXY_HELPER_H_
 
+#include <map>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "base/containers/circular_deque.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/ref_counted.h"
-#include "mojo/public/cpp/bindings/receiver.h"
+#include "base/time/time.h"
+#include "mojo/public/cpp/bindings/receiver_set.h"
 #include "services/network/public/mojom/proxy_lookup_client.mojom.h"
 #include "url/gurl.h"
 
@@ -19,16 +22,40 @@ namespace electron {
 
 class ElectronBrowserContext;
 
+// Resolves the proxies for URLs, running a few lookups at once and queueing
+// the rest. Results are cached briefly per URL as seen by PAC scripts, and
+// lookups for the same URL are shared.
 class ResolveProxyHelper
     : public base::RefCountedThreadSafe<ResolveProxyHelper>,
       network::mojom::ProxyLookupClient {
  public:
   using ResolveProxyCallback = base::OnceCallback<void(std::string)>;
 
+  struct Stats {
+    // Number of requests waiting for a lookup to be started.
+    size_t queue_depth = 0;
+    size_t active_lookups = 0;
+    uint64_t cache_hits = 0;
+    uint64_t lookups = 0;
+    base::TimeDelta average_latency;
+    base::TimeDelta max_latency;
+  };
+
   explicit ResolveProxyHelper(ElectronBrowserContext* browser_context);
 
   void ResolveProxy(const GURL& url, ResolveProxyCallback callback);
 
+  // Drops the cached results, to be called once the network service uses a
+  // new proxy configuration. Lookups that are in progress are not cached
+  // either.
+  void InvalidateCache();
+
+  // Returns a callback that invalidates the cache and then runs |callback|, to
+  // be passed to NetworkContext::ForceReloadProxyConfig.
+  base::OnceClosure InvalidateCacheAndRun(base::OnceClosure callback);
+
+  Stats GetStats() const;
+
   // disable copy
   ResolveProxyHelper(const ResolveProxyHelper&) = delete;
   ResolveProxyHelper& operator=(const ResolveProxyHelper&) = delete;
@@ -55,20 +82,50 @@ class ResolveProxyHelper
     ResolveProxyCallback callback;
   };
 
-  // Starts the first pending request.
-  void StartPendingRequest();
+  // A lookup in progress, which the requests for the same key wait for.
+  struct Lookup {
+    Lookup();
+    Lookup(Lookup&&);
+    ~Lookup();
+
+    base::TimeTicks start_time;
+    // Value of |cache_generation_| when the lookup started.
+    uint64_t cache_generation = 0;
+    std::vector<ResolveProxyCallback> callbacks;
+  };
+
+  struct CacheEntry {
+    std::string proxy;
+    base::TimeTicks expiry;
+  };
+
+  // Starts lookups for the pending requests while there are free slots.
+  void StartPendingRequests();
+  void StartLookup(const std::string& key, const GURL& url);
+
+  // Serves |request| from the cache or an in-progress lookup, and returns
+  // false if a new lookup is needed.
+  bool MaybeServeRequest(const std::string& key, PendingRequest& request);
 
   // network::mojom::ProxyLookupClient implementation.
   void OnProxyLookupComplete(
       int32_t net_error,
       const std::optional<net::ProxyInfo>& proxy_info) override;
-
-  // Self-reference. Owned as long as there's an outstanding proxy lookup.
-  scoped_refptr<ResolveProxyHelper> owned_self_;
+  void CompleteLookup(const std::string& key, std::string proxy, bool cache);
 
   base::circular_deque<PendingRequest> pending_requests_;
-  // Receiver for the currently in-progress request, if any.
-  mojo::Receiver<network::mojom::ProxyLookupClient> receiver_{this};
+  // Lookups in progress, keyed like |cache_|. Each receiver's context is the
+  // key of its lookup.
+  std::map<std::string, Lookup> lookups_;
+  mojo::ReceiverSet<network::mojom::ProxyLookupClient, std::string> receivers_;
+
+  std::map<std::string, CacheEntry> cache_;
+  uint64_t cache_generation_ = 0;
+
+  uint64_t cache_hits_ = 0;
+  uint64_t completed_lookups_ = 0;
+  base::TimeDelta total_latency_;
+  base::TimeDelta max_latency_;
 
   // Weak Ref
   raw_ptr<ElectronBrowserContext> browser_context_;
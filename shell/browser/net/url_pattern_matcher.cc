@@ -0,0 +1,146 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/net/url_pattern_matcher.h"
+
+#include <utility>
+
+#include "base/containers/fixed_flat_map.h"
+#include "base/strings/string_util.h"
+#include "url/gurl.h"
+#include "url/url_constants.h"
+
+namespace electron {
+
+namespace {
+
+constexpr auto kSchemeBits = base::MakeFixedFlatMap<std::string_view, uint32_t>(
+    {{url::kHttpScheme, 1u << 0},
+     {url::kHttpsScheme, 1u << 1},
+     {url::kWsScheme, 1u << 2},
+     {url::kWssScheme, 1u << 3},
+     {url::kFileScheme, 1u << 4},
+     {url::kFtpScheme, 1u << 5},
+     {url::kDataScheme, 1u << 6},
+     {url::kBlobScheme, 1u << 7},
+     {url::kAboutScheme, 1u << 8}});
+
+// Stands for all the schemes that are not in |kSchemeBits|.
+constexpr uint32_t kOtherSchemes = 1u << 31;
+
+uint32_t SchemeBit(std::string_view scheme) {
+  const auto iter = kSchemeBits.find(scheme);
+  return iter != kSchemeBits.end() ? iter->second : kOtherSchemes;
+}
+
+uint32_t GetSchemeMask(const URLPattern& pattern) {
+  uint32_t mask = 0;
+  for (const auto& [scheme, bit] : kSchemeBits) {
+    if (pattern.MatchesScheme(scheme))
+      mask |= bit;
+  }
+  if (pattern.scheme() == "*" || SchemeBit(pattern.scheme()) == kOtherSchemes)
+    mask |= kOtherSchemes;
+  return mask;
+}
+
+// Hosts are compared without a trailing dot, like URLPattern does.
+std::string_view CanonicalizeHost(std::string_view host) {
+  if (host.ends_with('.'))
+    host.remove_suffix(1);
+  return host;
+}
+
+// A URL can only match a pattern if its path starts with the part of the
+// pattern's path before the first wildcard. The trailing slash is dropped
+// because "/foo/*" also matches "/foo".
+std::string GetPathPrefix(const URLPattern& pattern) {
+  std::string_view path = pattern.path();
+  path = path.substr(0, path.find_first_of("*\\"));
+  if (path.ends_with('/'))
+    path.remove_suffix(1);
+  return std::string(path);
+}
+
+}  // namespace
+
+URLPatternMatcher::URLPatternMatcher() = default;
+URLPatternMatcher::URLPatternMatcher(const URLPatternMatcher&) = default;
+URLPatternMatcher& URLPatternMatcher::operator=(const URLPatternMatcher&) =
+    default;
+URLPatternMatcher::URLPatternMatcher(URLPatternMatcher&&) = default;
+URLPatternMatcher& URLPatternMatcher::operator=(URLPatternMatcher&&) = default;
+URLPatternMatcher::~URLPatternMatcher() = default;
+
+void URLPatternMatcher::AddPattern(URLPattern pattern) {
+  Entry entry{patterns_.size(), GetSchemeMask(pattern),
+              GetPathPrefix(pattern)};
+  const std::string host =
+      base::ToLowerASCII(CanonicalizeHost(pattern.host()));
+
+  // URLPattern ignores the host of file URLs.
+  if (pattern.match_all_urls() || pattern.scheme() == url::kFileScheme ||
+      host.find('*') != std::string::npos ||
+      (pattern.match_subdomains() && host.empty())) {
+    any_host_.push_back(std::move(entry));
+  } else if (pattern.match_subdomains()) {
+    domains_[host].push_back(std::move(entry));
+  } else {
+    hosts_[host].push_back(std::move(entry));
+  }
+  patterns_.push_back(std::move(pattern));
+}
+
+bool URLPatternMatcher::MatchesURL(const GURL& url) const {
+  if (patterns_.empty() || !url.is_valid())
+    return false;
+
+  // Nested URLs are matched by their inner URL, so skip the index for these.
+  if (url.inner_url()) {
+    for (const auto& pattern : patterns_) {
+      if (pattern.MatchesURL(url))
+        return true;
+    }
+    return false;
+  }
+
+  const uint32_t scheme = SchemeBit(url.scheme_piece());
+  const std::string_view path = url.PathForRequestPiece();
+  if (MatchesBucket(any_host_, url, scheme, path))
+    return true;
+
+  const std::string_view host = CanonicalizeHost(url.host_piece());
+  if (!hosts_.empty()) {
+    const auto iter = hosts_.find(host);
+    if (iter != hosts_.end() && MatchesBucket(iter->second, url, scheme, path))
+      return true;
+  }
+
+  // Look up the host and each domain it is a subdomain of.
+  for (std::string_view domain = host; !domains_.empty() && !domain.empty();) {
+    const auto iter = domains_.find(domain);
+    if (iter != domains_.end() &&
+        MatchesBucket(iter->second, url, scheme, path))
+      return true;
+    const size_t dot = domain.find('.');
+    if (dot == std::string_view::npos)
+      break;
+    domain.remove_prefix(dot + 1);
+  }
+  return false;
+}
+
+bool URLPatternMatcher::MatchesBucket(const Bucket& bucket,
+                                      const GURL& url,
+                                      uint32_t scheme,
+                                      std::string_view path) const {
+  for (const auto& entry : bucket) {
+    if ((entry.schemes & scheme) && path.starts_with(entry.path_prefix) &&
+        patterns_[entry.index].MatchesURL(url))
+      return true;
+  }
+  return false;
+}
+
+}  // namespace electron
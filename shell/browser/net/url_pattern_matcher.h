@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_NET_URL_PATTERN_MATCHER_H_
+#define ELECTRON_SHELL_BROWSER_NET_URL_PATTERN_MATCHER_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "extensions/common/url_pattern.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
+
+class GURL;
+
+namespace electron {
+
+// Matches URLs against a set of URLPatterns without testing every pattern.
+// Patterns are indexed by host when they are added: a URL is only tested
+// against the patterns for its host, for the domains its host is a subdomain
+// of, and those that match any host. Candidates are further filtered by
+// scheme and by the literal prefix of their path before the pattern itself
+// is consulted, so results are identical to testing each pattern in turn.
+class URLPatternMatcher {
+ public:
+  URLPatternMatcher();
+  URLPatternMatcher(const URLPatternMatcher&);
+  URLPatternMatcher& operator=(const URLPatternMatcher&);
+  URLPatternMatcher(URLPatternMatcher&&);
+  URLPatternMatcher& operator=(URLPatternMatcher&&);
+  ~URLPatternMatcher();
+
+  void AddPattern(URLPattern pattern);
+
+  // Whether any of the patterns matches |url|.
+  bool MatchesURL(const GURL& url) const;
+
+  bool empty() const { return patterns_.empty(); }
+  size_t size() const { return patterns_.size(); }
+
+ private:
+  struct Entry {
+    size_t index;
+    // Bitmask of the schemes the pattern may match, see SchemeBit().
+    uint32_t schemes;
+    // The part of the path before its first wildcard.
+    std::string path_prefix;
+  };
+  using Bucket = std::vector<Entry>;
+
+  bool MatchesBucket(const Bucket& bucket,
+                     const GURL& url,
+                     uint32_t scheme,
+                     std::string_view path) const;
+
+  std::vector<URLPattern> patterns_;
+
+  // Patterns that match any host, e.g. <all_urls>, *://*/* or file:///*.
+  Bucket any_host_;
+  // Patterns for one host, keyed by host.
+  absl::flat_hash_map<std::string, Bucket> hosts_;
+  // Patterns for a domain and its subdomains, keyed by domain.
+  absl::flat_hash_map<std::string, Bucket> domains_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_NET_URL_PATTERN_MATCHER_H_
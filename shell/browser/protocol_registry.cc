@@ -42,8 +42,11 @@ void ProtocolRegistry::RegisterURLLoaderFactories(
 
   for (const auto& it : handlers_) {
     factories->emplace(it.first, ElectronURLLoaderFactory::Create(
-                                     it.second.first, it.second.second));
+                                     it.second.first, it.second.second,
+                                     FindResponseCache(it.first)));
   }
+  for (const auto& it : directory_handlers_)
+    factories->emplace(it.first, DirectoryURLLoaderFactory::Create(it.second));
 }
 
 mojo::PendingRemote<network::mojom::URLLoaderFactory>
@@ -54,23 +57,49 @@ ProtocolRegistry::CreateNonNetworkNavigationURLLoaderFactory(
       return AsarURLLoaderFactory::Create();
     }
   } else {
-    auto handler = handlers_.find(scheme);
-    if (handler != handlers_.end()) {
-      return ElectronURLLoaderFactory::Create(handler->second.first,
-                                              handler->second.second);
-    }
+    return CreateRegisteredURLLoaderFactory(scheme);
+  }
+  return {};
+}
+
+mojo::PendingRemote<network::mojom::URLLoaderFactory>
+ProtocolRegistry::CreateRegisteredURLLoaderFactory(
+    std::string_view scheme) const {
+  if (const auto* handler = FindRegistered(scheme)) {
+    return ElectronURLLoaderFactory::Create(handler->first, handler->second,
+                                            FindResponseCache(scheme));
   }
+  if (const auto* options = FindDirectoryHandler(scheme))
+    return DirectoryURLLoaderFactory::Create(*options);
   return {};
 }
 
 bool ProtocolRegistry::RegisterProtocol(ProtocolType type,
                                         const std::string& scheme,
                                         const ProtocolHandler& handler) {
+  if (directory_handlers_.contains(scheme))
+    return false;
   return handlers_.try_emplace(scheme, type, handler).second;
 }
 
 bool ProtocolRegistry::UnregisterProtocol(const std::string& scheme) {
-  return handlers_.erase(scheme) != 0;
+  response_caches_.erase(scheme);
+  const bool removed_directory = directory_handlers_.erase(scheme) != 0;
+  return handlers_.erase(scheme) != 0 || removed_directory;
+}
+
+bool ProtocolRegistry::RegisterDirectoryHandler(
+    const std::string& scheme,
+    const DirectoryURLLoaderFactory::Options& options) {
+  if (handlers_.contains(scheme))
+    return false;
+  return directory_handlers_.try_emplace(scheme, options).second;
+}
+
+const DirectoryURLLoaderFactory::Options*
+ProtocolRegistry::FindDirectoryHandler(const std::string_view scheme) const {
+  const auto iter = directory_handlers_.find(scheme);
+  return iter != std::end(directory_handlers_) ? &iter->second : nullptr;
 }
 
 const HandlersMap::mapped_type* ProtocolRegistry::FindRegistered(
@@ -80,6 +109,21 @@ const HandlersMap::mapped_type* ProtocolRegistry::FindRegistered(
   return iter != std::end(map) ? &iter->second : nullptr;
 }
 
+void ProtocolRegistry::SetResponseCache(
+    const std::string& scheme,
+    scoped_refptr<ProtocolResponseCache> cache) {
+  if (cache)
+    response_caches_[scheme] = std::move(cache);
+  else
+    response_caches_.erase(scheme);
+}
+
+ProtocolResponseCache* ProtocolRegistry::FindResponseCache(
+    const std::string_view scheme) const {
+  const auto iter = response_caches_.find(scheme);
+  return iter != std::end(response_caches_) ? iter->second.get() : nullptr;
+}
+
 bool ProtocolRegistry::InterceptProtocol(ProtocolType type,
                                          const std::string& scheme,
                                          const ProtocolHandler& handler) {
@@ -5,11 +5,15 @@
 #ifndef ELECTRON_SHELL_BROWSER_PROTOCOL_REGISTRY_H_
 #define ELECTRON_SHELL_BROWSER_PROTOCOL_REGISTRY_H_
 
+#include <map>
 #include <string>
 #include <string_view>
 
+#include "base/memory/scoped_refptr.h"
 #include "content/public/browser/content_browser_client.h"
+#include "shell/browser/net/directory_url_loader_factory.h"
 #include "shell/browser/net/electron_url_loader_factory.h"
+#include "shell/browser/net/protocol_response_cache.h"
 
 namespace content {
 class BrowserContext;
@@ -33,6 +37,11 @@ class ProtocolRegistry {
   mojo::PendingRemote<network::mojom::URLLoaderFactory>
   CreateNonNetworkNavigationURLLoaderFactory(const std::string& scheme);
 
+  // Returns a factory for a scheme registered with either a handler or a
+  // directory, or an invalid remote when |scheme| is not registered.
+  mojo::PendingRemote<network::mojom::URLLoaderFactory>
+  CreateRegisteredURLLoaderFactory(std::string_view scheme) const;
+
   const HandlersMap& intercept_handlers() const { return intercept_handlers_; }
 
   bool RegisterProtocol(ProtocolType type,
@@ -43,6 +52,20 @@ class ProtocolRegistry {
   [[nodiscard]] const HandlersMap::mapped_type* FindRegistered(
       std::string_view scheme) const;
 
+  // Schemes served natively from a directory. These share the namespace of
+  // registered schemes and are removed by UnregisterProtocol().
+  bool RegisterDirectoryHandler(
+      const std::string& scheme,
+      const DirectoryURLLoaderFactory::Options& options);
+  [[nodiscard]] const DirectoryURLLoaderFactory::Options* FindDirectoryHandler(
+      std::string_view scheme) const;
+
+  // Response caches of registered schemes, dropped on unregistration.
+  void SetResponseCache(const std::string& scheme,
+                        scoped_refptr<ProtocolResponseCache> cache);
+  [[nodiscard]] ProtocolResponseCache* FindResponseCache(
+      std::string_view scheme) const;
+
   bool InterceptProtocol(ProtocolType type,
                          const std::string& scheme,
                          const ProtocolHandler& handler);
@@ -58,6 +81,12 @@ class ProtocolRegistry {
 
   HandlersMap handlers_;
   HandlersMap intercept_handlers_;
+
+  std::map<std::string, DirectoryURLLoaderFactory::Options, std::less<>>
+      directory_handlers_;
+
+  std::map<std::string, scoped_refptr<ProtocolResponseCache>, std::less<>>
+      response_caches_;
 };
 
 }  // namespace electron
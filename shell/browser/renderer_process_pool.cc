@@ -0,0 +1,171 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/renderer_process_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/memory/ptr_util.h"
+#include "base/task/sequenced_task_runner.h"
+#include "content/public/browser/browser_context.h"
+#include "content/public/browser/child_process_termination_info.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/render_process_host.h"
+#include "content/public/browser/site_instance.h"
+#include "content/public/browser/web_contents.h"
+#include "content/public/common/result_codes.h"
+#include "shell/browser/web_contents_preferences.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/options_switches.h"
+
+namespace electron {
+
+// static
+int RendererProcessPool::kLocatorKey = 0;
+
+// static
+RendererProcessPool* RendererProcessPool::FromBrowserContext(
+    content::BrowserContext* context) {
+  return static_cast<RendererProcessPool*>(context->GetUserData(&kLocatorKey));
+}
+
+// static
+void RendererProcessPool::SetForBrowserContext(
+    content::BrowserContext* context,
+    size_t size,
+    const gin_helper::Dictionary& web_preferences) {
+  DCHECK(context);
+  DestroyForBrowserContext(context);
+  if (size == 0)
+    return;
+
+  auto* pool = new RendererProcessPool(context, size, web_preferences);
+  context->SetUserData(&kLocatorKey, base::WrapUnique(pool));
+  pool->Fill();
+}
+
+// static
+void RendererProcessPool::DestroyForBrowserContext(
+    content::BrowserContext* context) {
+  context->RemoveUserData(&kLocatorKey);
+}
+
+RendererProcessPool::RendererProcessPool(
+    content::BrowserContext* context,
+    size_t size,
+    const gin_helper::Dictionary& web_preferences)
+    : browser_context_(context),
+      size_(size),
+      scratch_web_contents_(content::WebContents::Create(
+          content::WebContents::CreateParams(context))) {
+  new WebContentsPreferences(scratch_web_contents_.get(), web_preferences);
+  switches_ = GetSwitches(web_preferences);
+}
+
+RendererProcessPool::~RendererProcessPool() {
+  for (auto& entry : entries_) {
+    entry.host->RemoveObserver(this);
+    entry.host->Shutdown(content::RESULT_CODE_NORMAL_EXIT);
+  }
+}
+
+scoped_refptr<content::SiteInstance> RendererProcessPool::Claim(
+    const gin_helper::Dictionary& web_preferences) {
+  if (entries_.empty() ||
+      GetSwitches(web_preferences).argv() != switches_.argv()) {
+    ++misses_;
+    return nullptr;
+  }
+
+  Entry entry = std::move(entries_.front());
+  entries_.erase(entries_.begin());
+  entry.host->RemoveObserver(this);
+  ++hits_;
+
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(&RendererProcessPool::Fill,
+                                weak_factory_.GetWeakPtr()));
+  return std::move(entry.site_instance);
+}
+
+bool RendererProcessPool::AppendCommandLineSwitches(
+    content::RenderProcessHost* host,
+    base::CommandLine* command_line) const {
+  if (std::ranges::none_of(
+          entries_, [host](const Entry& entry) { return entry.host == host; }))
+    return false;
+
+  for (const auto& [name, value] : switches_.GetSwitches()) {
+    if (!command_line->HasSwitch(name))
+      command_line->AppendSwitchNative(name, value);
+  }
+  for (const auto& arg : switches_.GetArgs())
+    command_line->AppendArgNative(arg);
+  return true;
+}
+
+bool RendererProcessPool::IsReservedProcess(
+    content::RenderProcessHost* host) const {
+  return host == scratch_web_contents_->GetPrimaryMainFrame()->GetProcess() ||
+         std::ranges::any_of(entries_, [host](const Entry& entry) {
+           return entry.host == host;
+         });
+}
+
+base::CommandLine RendererProcessPool::GetSwitches(
+    const gin_helper::Dictionary& web_preferences) {
+  auto* preferences = WebContentsPreferences::From(scratch_web_contents_.get());
+  preferences->SetFromDictionary(web_preferences);
+
+  // ElectronBrowserClient copies --enable-sandbox before the switches of the
+  // preferences are appended, and they depend on it.
+  static constexpr std::array<const char*, 1U> kInheritedSwitchNames = {
+      switches::kEnableSandbox.c_str()};
+  base::CommandLine command_line(base::CommandLine::NO_PROGRAM);
+  command_line.CopySwitchesFrom(*base::CommandLine::ForCurrentProcess(),
+                                kInheritedSwitchNames);
+  preferences->AppendCommandLineSwitches(&command_line, false);
+  return command_line;
+}
+
+void RendererProcessPool::Fill() {
+  while (entries_.size() < size_) {
+    auto site_instance = content::SiteInstance::Create(browser_context_);
+    content::RenderProcessHost* host = site_instance->GetProcess();
+    // The process limit was reached and an existing process was picked.
+    if (host->IsInitializedAndNotDead())
+      return;
+
+    host->AddObserver(this);
+    entries_.push_back({std::move(site_instance), host});
+    if (!host->Init()) {
+      RemoveEntry(host);
+      return;
+    }
+  }
+}
+
+void RendererProcessPool::RemoveEntry(content::RenderProcessHost* host) {
+  host->RemoveObserver(this);
+  std::erase_if(entries_,
+                [host](const Entry& entry) { return entry.host == host; });
+}
+
+void RendererProcessPool::RenderProcessExited(
+    content::RenderProcessHost* host,
+    const content::ChildProcessTerminationInfo& info) {
+  // Dead processes are not relaunched, so that a renderer that keeps crashing
+  // on startup is not launched over and over. The next claim refills the pool.
+  RemoveEntry(host);
+}
+
+void RendererProcessPool::RenderProcessHostDestroyed(
+    content::RenderProcessHost* host) {
+  RemoveEntry(host);
+}
+
+}  // namespace electron
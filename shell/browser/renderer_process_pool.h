@@ -0,0 +1,122 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_RENDERER_PROCESS_POOL_H_
+#define ELECTRON_SHELL_BROWSER_RENDERER_PROCESS_POOL_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base/command_line.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/supports_user_data.h"
+#include "content/public/browser/render_process_host_observer.h"
+
+namespace content {
+class BrowserContext;
+class RenderProcessHost;
+class SiteInstance;
+class WebContents;
+}  // namespace content
+
+namespace gin_helper {
+class Dictionary;
+}
+
+namespace electron {
+
+// Keeps a number of renderer processes of a session launched ahead of use,
+// with the command line switches of a given set of webPreferences. A new
+// WebContents whose webPreferences result in the same switches is created in
+// the SiteInstance of one of these processes instead of launching its own.
+class RendererProcessPool : public base::SupportsUserData::Data,
+                            private content::RenderProcessHostObserver {
+ public:
+  static RendererProcessPool* FromBrowserContext(
+      content::BrowserContext* context);
+
+  // Replaces the pool of |context| with one of |size| processes, or removes
+  // it when |size| is 0.
+  static void SetForBrowserContext(
+      content::BrowserContext* context,
+      size_t size,
+      const gin_helper::Dictionary& web_preferences);
+
+  // Shuts down the pool of |context|, if any. Must be called before
+  // |context| starts being destroyed, as the pool owns a WebContents and
+  // SiteInstances of it.
+  static void DestroyForBrowserContext(content::BrowserContext* context);
+
+  ~RendererProcessPool() override;
+
+  // disable copy
+  RendererProcessPool(const RendererProcessPool&) = delete;
+  RendererProcessPool& operator=(const RendererProcessPool&) = delete;
+
+  // Returns the SiteInstance of a launched process that can host a
+  // WebContents with |web_preferences|, or nullptr when there is none.
+  // Counts a hit or a miss, and launches a replacement for a claimed process.
+  scoped_refptr<content::SiteInstance> Claim(
+      const gin_helper::Dictionary& web_preferences);
+
+  // Appends the switches of the pool to |command_line| if |host| is one of
+  // the processes of the pool. Returns whether it is.
+  bool AppendCommandLineSwitches(content::RenderProcessHost* host,
+                                 base::CommandLine* command_line) const;
+
+  // Whether |host| belongs to the pool and must not be used for anything else.
+  bool IsReservedProcess(content::RenderProcessHost* host) const;
+
+  size_t size() const { return size_; }
+  size_t available() const { return entries_.size(); }
+  uint64_t hits() const { return hits_; }
+  uint64_t misses() const { return misses_; }
+
+ private:
+  struct Entry {
+    scoped_refptr<content::SiteInstance> site_instance;
+    raw_ptr<content::RenderProcessHost> host;
+  };
+
+  RendererProcessPool(content::BrowserContext* context,
+                      size_t size,
+                      const gin_helper::Dictionary& web_preferences);
+
+  // Returns the switches a renderer process gets for |web_preferences|.
+  base::CommandLine GetSwitches(const gin_helper::Dictionary& web_preferences);
+
+  // Launches processes until there are |size_| of them.
+  void Fill();
+  void RemoveEntry(content::RenderProcessHost* host);
+
+  // content::RenderProcessHostObserver:
+  void RenderProcessExited(
+      content::RenderProcessHost* host,
+      const content::ChildProcessTerminationInfo& info) override;
+  void RenderProcessHostDestroyed(content::RenderProcessHost* host) override;
+
+  // The user data key.
+  static int kLocatorKey;
+
+  raw_ptr<content::BrowserContext> browser_context_;
+  const size_t size_;
+
+  // Never navigated, only holds the WebContentsPreferences used to compute
+  // the switches of webPreferences.
+  std::unique_ptr<content::WebContents> scratch_web_contents_;
+  base::CommandLine switches_{base::CommandLine::NO_PROGRAM};
+
+  std::vector<Entry> entries_;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+
+  base::WeakPtrFactory<RendererProcessPool> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_RENDERER_PROCESS_POOL_H_
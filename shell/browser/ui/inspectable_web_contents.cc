@@ -682,12 +682,12 @@ void InspectableWebContents::LoadNetworkResource(DispatchCallback callback,
     url_loader_factory = network::SharedURLLoaderFactory::Create(
         std::make_unique<network::WrapperPendingSharedURLLoaderFactory>(
             std::move(pending_remote)));
-  } else if (const auto* const protocol_handler =
-                 protocol_registry->FindRegistered(gurl.scheme_piece())) {
+  } else if (auto factory =
+                 protocol_registry->CreateRegisteredURLLoaderFactory(
+                     gurl.scheme_piece())) {
     url_loader_factory = network::SharedURLLoaderFactory::Create(
         std::make_unique<network::WrapperPendingSharedURLLoaderFactory>(
-            ElectronURLLoaderFactory::Create(protocol_handler->first,
-                                             protocol_handler->second)));
+            std::move(factory)));
   } else {
     auto* partition = GetDevToolsWebContents()
                           ->GetBrowserContext()
@@ -114,6 +114,7 @@ void WebContentsPreferences::Clear() {
   node_integration_ = false;
   node_integration_in_sub_frames_ = false;
   node_integration_in_worker_ = false;
+  node_integration_shared_environment_ = false;
   disable_html_fullscreen_window_resize_ = false;
   webview_tag_ = false;
   sandbox_ = std::nullopt;
@@ -170,6 +171,8 @@ void WebContentsPreferences::SetFromDictionary(
                       &node_integration_in_sub_frames_);
   web_preferences.Get(options::kNodeIntegrationInWorker,
                       &node_integration_in_worker_);
+  web_preferences.Get(options::kNodeIntegrationSharedEnvironment,
+                      &node_integration_shared_environment_);
   web_preferences.Get(options::kDisableHtmlFullscreenWindowResize,
                       &disable_html_fullscreen_window_resize_);
   web_preferences.Get(options::kWebviewTag, &webview_tag_);
@@ -353,6 +356,9 @@ void WebContentsPreferences::AppendCommandLineSwitches(
   if (node_integration_in_worker_)
     command_line->AppendSwitch(switches::kNodeIntegrationInWorker);
 
+  if (node_integration_in_sub_frames_ && node_integration_shared_environment_)
+    command_line->AppendSwitch(switches::kNodeIntegrationSharedEnvironment);
+
   // We are appending args to a webContents so let's save the current state
   // of our preferences object so that during the lifetime of the WebContents
   // we can fetch the options used to initially configure the WebContents
@@ -100,6 +100,7 @@ class WebContentsPreferences
   bool node_integration_;
   bool node_integration_in_sub_frames_;
   bool node_integration_in_worker_;
+  bool node_integration_shared_environment_;
   bool disable_html_fullscreen_window_resize_;
   bool webview_tag_;
   std::optional<bool> sandbox_;
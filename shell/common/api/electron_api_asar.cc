@@ -2,6 +2,8 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "gin/handle.h"
@@ -28,6 +30,7 @@ class Archive : public node::ObjectWrap {
     NODE_SET_PROTOTYPE_METHOD(tpl, "copyFileOut", &Archive::CopyFileOut);
     NODE_SET_PROTOTYPE_METHOD(tpl, "getFdAndValidateIntegrityLater",
                               &Archive::GetFD);
+    NODE_SET_PROTOTYPE_METHOD(tpl, "getHeaderHash", &Archive::GetHeaderHash);
 
     return tpl;
   }
@@ -185,6 +188,21 @@ class Archive : public node::ObjectWrap {
         isolate, wrap->archive_ ? wrap->archive_->GetUnsafeFD() : -1));
   }
 
+  // Returns the hash of the archive's header.
+  static void GetHeaderHash(const v8::FunctionCallbackInfo<v8::Value>& args) {
+    auto* isolate = args.GetIsolate();
+    auto* wrap = node::ObjectWrap::Unwrap<Archive>(args.This());
+
+    std::optional<std::string> hash;
+    if (wrap->archive_)
+      hash = wrap->archive_->HeaderHash();
+    if (!hash) {
+      args.GetReturnValue().Set(v8::False(isolate));
+      return;
+    }
+    args.GetReturnValue().Set(gin::ConvertToV8(isolate, *hash));
+  }
+
   std::shared_ptr<asar::Archive> archive_;
 };
 
@@ -4,17 +4,26 @@
 
 #include "shell/common/api/electron_api_native_image.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/barrier_callback.h"
+#include "base/containers/queue.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
+#include "base/memory/raw_span.h"
 #include "base/memory/ref_counted_memory.h"
+#include "base/memory/weak_ptr.h"
 #include "base/numerics/safe_conversions.h"
 #include "base/strings/pattern.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/system/sys_info.h"
+#include "base/task/thread_pool.h"
+#include "base/threading/sequence_local_storage_slot.h"
 #include "gin/arguments.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
@@ -25,18 +34,24 @@
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/gfx_converter.h"
 #include "shell/common/gin_converters/gurl_converter.h"
+#include "shell/common/gin_converters/image_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/function_template_extensions.h"
+#include "shell/common/gin_helper/locker.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/node_util.h"
 #include "shell/common/process_util.h"
 #include "shell/common/skia_util.h"
 #include "shell/common/thread_restrictions.h"
+#include "skia/ext/image_operations.h"
+#include "third_party/libyuv/include/libyuv/scale_argb.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/core/SkPixmap.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
 #include "ui/base/layout.h"
 #include "ui/base/resource/resource_scale_factor.h"
@@ -46,6 +61,7 @@
 #include "ui/gfx/geometry/size.h"
 #include "ui/gfx/image/image_skia.h"
 #include "ui/gfx/image/image_skia_operations.h"
+#include "ui/gfx/image/image_skia_source.h"
 #include "ui/gfx/image/image_util.h"
 
 #if BUILDFLAG(IS_WIN)
@@ -126,6 +142,258 @@ base::win::ScopedGDIObject<HICON> ReadICOFromPath(int size,
   return node::Buffer::New(isolate, 0).ToLocalChecked();
 }
 
+// Runs the encode/decode/resample work behind the *Async methods on the
+// thread pool. At most |max_in_flight_| jobs per calling sequence are posted
+// at once so that a burst of calls can't monopolize the pool's workers.
+class ImageJobQueue {
+ public:
+  static ImageJobQueue& GetForCurrentSequence() {
+    static base::SequenceLocalStorageSlot<ImageJobQueue> slot;
+    return slot.GetOrCreateValue();
+  }
+
+  ImageJobQueue()
+      : max_in_flight_(std::max(1, base::SysInfo::NumberOfProcessors() / 2)) {}
+
+  // disable copy
+  ImageJobQueue(const ImageJobQueue&) = delete;
+  ImageJobQueue& operator=(const ImageJobQueue&) = delete;
+
+  template <typename T>
+  void PostJob(base::OnceCallback<T()> job, base::OnceCallback<void(T)> reply) {
+    pending_.push(base::BindOnce(
+        [](base::WeakPtr<ImageJobQueue> queue, base::OnceCallback<T()> job,
+           base::OnceCallback<void(T)> reply) {
+          base::ThreadPool::PostTaskAndReplyWithResult(
+              FROM_HERE,
+              {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+               base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+              std::move(job),
+              base::BindOnce(
+                  [](base::WeakPtr<ImageJobQueue> queue,
+                     base::OnceCallback<void(T)> reply, T result) {
+                    if (queue)
+                      queue->OnJobDone();
+                    std::move(reply).Run(std::move(result));
+                  },
+                  queue, std::move(reply)));
+        },
+        weak_factory_.GetWeakPtr(), std::move(job), std::move(reply)));
+    MaybeStartJobs();
+  }
+
+ private:
+  void MaybeStartJobs() {
+    while (in_flight_ < max_in_flight_ && !pending_.empty()) {
+      ++in_flight_;
+      base::OnceClosure job = std::move(pending_.front());
+      pending_.pop();
+      std::move(job).Run();
+    }
+  }
+
+  void OnJobDone() {
+    --in_flight_;
+    MaybeStartJobs();
+  }
+
+  const int max_in_flight_;
+  int in_flight_ = 0;
+  base::queue<base::OnceClosure> pending_;
+
+  base::WeakPtrFactory<ImageJobQueue> weak_factory_{this};
+};
+
+using ImageSkiaReps = std::vector<gfx::ImageSkiaRep>;
+
+gfx::Image ImageFromReps(const ImageSkiaReps& reps) {
+  gfx::ImageSkia image_skia;
+  for (const auto& rep : reps)
+    image_skia.AddRepresentation(rep);
+  return gfx::Image(image_skia);
+}
+
+// The helpers below run on the thread pool. They only ever see SkBitmaps and
+// ImageSkiaReps, which are safe to share across threads, never the
+// gfx::ImageSkia owned by the calling thread.
+
+std::optional<std::vector<uint8_t>> EncodePNG(const SkBitmap& bitmap) {
+  return gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false);
+}
+
+std::optional<std::vector<uint8_t>> EncodeJPEG(const SkBitmap& bitmap,
+                                               int quality) {
+  return gfx::JPEGCodec::Encode(bitmap, quality);
+}
+
+ImageSkiaReps DecodeImageFromBuffer(std::vector<uint8_t> data,
+                                    int width,
+                                    int height,
+                                    double scale_factor) {
+  gfx::ImageSkia image_skia;
+  electron::util::AddImageSkiaRepFromBuffer(&image_skia, data, width, height,
+                                            scale_factor);
+  return image_skia.image_reps();
+}
+
+// How a resize resamples pixels. |filter| is set when the caller asked for a
+// specific algorithm through the `filter` option; otherwise |quality| is
+// passed to skia, which maps it to a platform-dependent algorithm.
+struct ResampleOptions {
+  enum class Filter { kDefault, kNearest, kBilinear, kLanczos3 };
+
+  Filter filter = Filter::kDefault;
+  skia::ImageOperations::ResizeMethod quality =
+      skia::ImageOperations::ResizeMethod::RESIZE_BEST;
+};
+
+// Throws a TypeError and returns nullopt for an unknown `filter`.
+std::optional<ResampleOptions> GetResampleOptions(
+    gin_helper::ErrorThrower thrower,
+    const base::Value::Dict& options) {
+  ResampleOptions resample;
+  const std::string* quality = options.FindString("quality");
+  if (quality && *quality == "good")
+    resample.quality = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
+  else if (quality && *quality == "better")
+    resample.quality = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+
+  const std::string* filter = options.FindString("filter");
+  if (!filter)
+    return resample;
+  if (*filter == "nearest") {
+    resample.filter = ResampleOptions::Filter::kNearest;
+  } else if (*filter == "bilinear") {
+    resample.filter = ResampleOptions::Filter::kBilinear;
+  } else if (*filter == "lanczos3") {
+    resample.filter = ResampleOptions::Filter::kLanczos3;
+  } else {
+    thrower.ThrowTypeError("Invalid filter '" + *filter +
+                           "', must be one of nearest, bilinear or lanczos3");
+    return std::nullopt;
+  }
+  return resample;
+}
+
+// Points the bitmap produced by a resize at caller-owned memory instead of
+// allocating, so that resizeInto() writes straight into the caller's Buffer.
+class ExternalPixelAllocator : public SkBitmap::Allocator {
+ public:
+  explicit ExternalPixelAllocator(base::span<uint8_t> pixels)
+      : pixels_(pixels) {}
+
+  // SkBitmap::Allocator:
+  bool allocPixelRef(SkBitmap* bitmap) override {
+    if (bitmap->computeByteSize() > pixels_.size())
+      return false;
+    return bitmap->installPixels(bitmap->info(), pixels_.data(),
+                                 bitmap->rowBytes());
+  }
+
+ private:
+  base::raw_span<uint8_t> pixels_;
+};
+
+// Resamples |source| to |size| pixels. Nearest and bilinear filtering use
+// libyuv's vectorized ARGB scalers; everything else goes through skia's
+// convolver. Returns an empty bitmap on failure.
+SkBitmap ResampleBitmap(const SkBitmap& source,
+                        const ResampleOptions& options,
+                        const gfx::Size& size,
+                        SkBitmap::Allocator* allocator = nullptr) {
+  using Filter = ResampleOptions::Filter;
+
+  SkPixmap pixmap;
+  if (size.IsEmpty() || !source.peekPixels(&pixmap))
+    return {};
+
+  // libyuv's ARGB is B, G, R, A in memory.
+  if ((options.filter == Filter::kNearest ||
+       options.filter == Filter::kBilinear) &&
+      pixmap.colorType() == kBGRA_8888_SkColorType) {
+    SkBitmap result;
+    if (!result.setInfo(pixmap.info().makeWH(size.width(), size.height())) ||
+        !result.tryAllocPixels(allocator)) {
+      return {};
+    }
+    const int error = libyuv::ARGBScale(
+        static_cast<const uint8_t*>(pixmap.addr()),
+        base::checked_cast<int>(pixmap.rowBytes()), pixmap.width(),
+        pixmap.height(), static_cast<uint8_t*>(result.getPixels()),
+        base::checked_cast<int>(result.rowBytes()), size.width(),
+        size.height(),
+        options.filter == Filter::kNearest ? libyuv::kFilterNone
+                                           : libyuv::kFilterBilinear);
+    if (error)
+      return {};
+    result.setImmutable();
+    return result;
+  }
+
+  const skia::ImageOperations::ResizeMethod method =
+      options.filter == Filter::kDefault
+          ? options.quality
+          : skia::ImageOperations::ResizeMethod::RESIZE_LANCZOS3;
+  return skia::ImageOperations::Resize(pixmap, method, size.width(),
+                                       size.height(), allocator);
+}
+
+gfx::ImageSkiaRep ResizeImageRep(const gfx::ImageSkiaRep& rep,
+                                 const gfx::Size& size,
+                                 const ResampleOptions& options) {
+  return gfx::ImageSkiaRep(
+      ResampleBitmap(rep.GetBitmap(), options,
+                     gfx::ScaleToCeiledSize(size, rep.scale())),
+      rep.scale());
+}
+
+// Resamples the representations of |source| with an explicit filter as they
+// are requested, the way ImageSkiaOperations::CreateResizedImage() does with
+// skia's methods, so that every scale factor is covered.
+class ResampledImageSource : public gfx::ImageSkiaSource {
+ public:
+  ResampledImageSource(const gfx::ImageSkia& source,
+                       const gfx::Size& size,
+                       const ResampleOptions& options)
+      : source_(source), size_(size), options_(options) {}
+
+  // disable copy
+  ResampledImageSource(const ResampledImageSource&) = delete;
+  ResampledImageSource& operator=(const ResampledImageSource&) = delete;
+
+  // gfx::ImageSkiaSource:
+  gfx::ImageSkiaRep GetImageForScale(float scale) override {
+    return ResizeImageRep(source_.GetRepresentation(scale), size_, options_);
+  }
+
+ private:
+  const gfx::ImageSkia source_;
+  const gfx::Size size_;
+  const ResampleOptions options_;
+};
+
+void ResolveWithBuffer(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                       std::optional<std::vector<uint8_t>> data) {
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(
+      v8::Local<v8::Context>::New(isolate, promise.GetContext()));
+
+  if (!data) {
+    promise.Resolve(NewEmptyBuffer(isolate));
+    return;
+  }
+  promise.Resolve(electron::Buffer::Copy(isolate, *data).ToLocalChecked());
+}
+
+void ResolveWithImageReps(gin_helper::Promise<gfx::Image> promise,
+                          ImageSkiaReps reps) {
+  // Reps resampled in parallel come back in completion order.
+  std::ranges::sort(reps, {}, &gfx::ImageSkiaRep::scale);
+  promise.Resolve(ImageFromReps(reps));
+}
+
 }  // namespace
 
 NativeImage::NativeImage(v8::Isolate* isolate, const gfx::Image& image)
@@ -281,6 +549,67 @@ std::string NativeImage::ToDataURL(gin::Arguments* args) {
       image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap());
 }
 
+v8::Local<v8::Promise> NativeImage::ToPNGAsync(gin::Arguments* args) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  if (scale_factor == 1.0f) {
+    // Use raw 1x PNG bytes when available
+    const scoped_refptr<base::RefCountedMemory> png = image_.As1xPNGBytes();
+    const base::span<const uint8_t> png_span = *png;
+    if (!png_span.empty()) {
+      promise.Resolve(
+          electron::Buffer::Copy(args->isolate(), png_span).ToLocalChecked());
+      return handle;
+    }
+  }
+
+  // Resolve the representation here, ImageSkia may only be used on this
+  // thread.
+  ImageJobQueue::GetForCurrentSequence().PostJob(
+      base::BindOnce(
+          &EncodePNG,
+          image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap()),
+      base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
+}
+
+v8::Local<v8::Promise> NativeImage::ToJPEGAsync(v8::Isolate* isolate,
+                                                int quality) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (IsEmpty()) {
+    promise.Resolve(NewEmptyBuffer(isolate));
+    return handle;
+  }
+
+  ImageJobQueue::GetForCurrentSequence().PostJob(
+      base::BindOnce(&EncodeJPEG,
+                     image_.AsImageSkia().GetRepresentation(1.0f).GetBitmap(),
+                     quality),
+      base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
+}
+
+v8::Local<v8::Promise> NativeImage::ToDataURLAsync(gin::Arguments* args) {
+  gin_helper::Promise<std::string> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  ImageJobQueue::GetForCurrentSequence().PostJob(
+      base::BindOnce(
+          &webui::GetBitmapDataUrl,
+          image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap()),
+      base::BindOnce(
+          [](gin_helper::Promise<std::string> promise, std::string url) {
+            promise.Resolve(url);
+          },
+          std::move(promise)));
+  return handle;
+}
+
 v8::Local<v8::Value> NativeImage::GetBitmap(gin::Arguments* args) {
   static bool deprecated_warning_issued = false;
 
@@ -338,10 +667,9 @@ float NativeImage::GetAspectRatio(const std::optional<float> scale_factor) {
     return static_cast<float>(size.width()) / static_cast<float>(size.height());
 }
 
-gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
-                                             base::Value::Dict options) {
-  float scale_factor = GetScaleFactorFromOptions(args);
-
+std::optional<gfx::Size> NativeImage::GetResizedSize(
+    float scale_factor,
+    const base::Value::Dict& options) {
   gfx::Size size = GetSize(scale_factor);
   std::optional<int> new_width = options.FindInt("width");
   std::optional<int> new_height = options.FindInt("height");
@@ -350,7 +678,7 @@ gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
   size.SetSize(width, height);
 
   if (width <= 0 && height <= 0) {
-    return CreateEmpty(args->isolate());
+    return std::nullopt;
   } else if (new_width && !new_height) {
     // Scale height to preserve original aspect ratio
     size.set_height(width);
@@ -361,18 +689,107 @@ gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
     size.set_width(height);
     size = gfx::ScaleToRoundedSize(size, GetAspectRatio(scale_factor), 1.f);
   }
+  return size;
+}
 
-  skia::ImageOperations::ResizeMethod method =
-      skia::ImageOperations::ResizeMethod::RESIZE_BEST;
-  std::string* quality = options.FindString("quality");
-  if (quality && *quality == "good")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
-  else if (quality && *quality == "better")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
+                                             base::Value::Dict options) {
+  const std::optional<ResampleOptions> resample =
+      GetResampleOptions(gin_helper::ErrorThrower{args->isolate()}, options);
+  if (!resample)
+    return {};
+
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  const std::optional<gfx::Size> size = GetResizedSize(scale_factor, options);
+  if (!size)
+    return CreateEmpty(args->isolate());
+
+  if (resample->filter == ResampleOptions::Filter::kDefault) {
+    return Create(args->isolate(),
+                  gfx::Image{gfx::ImageSkiaOperations::CreateResizedImage(
+                      image_.AsImageSkia(), resample->quality, *size)});
+  }
 
+  const gfx::ImageSkia& image_skia = image_.AsImageSkia();
+  if (image_skia.isNull())
+    return CreateEmpty(args->isolate());
   return Create(args->isolate(),
-                gfx::Image{gfx::ImageSkiaOperations::CreateResizedImage(
-                    image_.AsImageSkia(), method, size)});
+                gfx::Image{gfx::ImageSkia(
+                    std::make_unique<ResampledImageSource>(image_skia, *size,
+                                                           *resample),
+                    *size)});
+}
+
+v8::Local<v8::Promise> NativeImage::ResizeAsync(gin::Arguments* args,
+                                                base::Value::Dict options) {
+  const std::optional<ResampleOptions> resample =
+      GetResampleOptions(gin_helper::ErrorThrower{args->isolate()}, options);
+  if (!resample)
+    return {};
+
+  gin_helper::Promise<gfx::Image> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  float scale_factor = GetScaleFactorFromOptions(args);
+  const std::optional<gfx::Size> size = GetResizedSize(scale_factor, options);
+  if (!size || IsEmpty()) {
+    promise.Resolve(gfx::Image());
+    return handle;
+  }
+
+  // Each representation is resampled as its own job so that the 1x, 2x, ...
+  // bitmaps are produced in parallel.
+  const ImageSkiaReps& reps = image_.AsImageSkia().image_reps();
+  auto barrier = base::BarrierCallback<gfx::ImageSkiaRep>(
+      reps.size(), base::BindOnce(&ResolveWithImageReps, std::move(promise)));
+  for (const auto& rep : reps) {
+    ImageJobQueue::GetForCurrentSequence().PostJob<gfx::ImageSkiaRep>(
+        base::BindOnce(&ResizeImageRep, rep, *size, *resample), barrier);
+  }
+  return handle;
+}
+
+v8::Local<v8::Value> NativeImage::ResizeInto(v8::Isolate* isolate,
+                                             v8::Local<v8::Value> buffer,
+                                             base::Value::Dict options) {
+  gin_helper::ErrorThrower thrower(isolate);
+  if (!node::Buffer::HasInstance(buffer)) {
+    thrower.ThrowTypeError("buffer must be a node Buffer");
+    return v8::Undefined(isolate);
+  }
+
+  const std::optional<ResampleOptions> resample =
+      GetResampleOptions(thrower, options);
+  if (!resample)
+    return v8::Undefined(isolate);
+
+  const float scale_factor =
+      static_cast<float>(options.FindDouble("scaleFactor").value_or(1.0));
+  const std::optional<gfx::Size> size = GetResizedSize(scale_factor, options);
+  const gfx::ImageSkiaRep& rep =
+      image_.AsImageSkia().GetRepresentation(scale_factor);
+  if (!size || rep.is_null())
+    return gin::ConvertToV8(isolate, gfx::Size());
+
+  const gfx::Size pixel_size = gfx::ScaleToCeiledSize(*size, rep.scale());
+  const size_t required_size =
+      SkImageInfo::MakeN32Premul(pixel_size.width(), pixel_size.height())
+          .computeMinByteSize();
+  const base::span<uint8_t> pixels = electron::Buffer::as_byte_span(buffer);
+  if (pixels.size() < required_size) {
+    thrower.ThrowRangeError("buffer must be at least " +
+                            base::NumberToString(required_size) +
+                            " bytes long");
+    return v8::Undefined(isolate);
+  }
+
+  ExternalPixelAllocator allocator(pixels);
+  const SkBitmap result = ResampleBitmap(
+      rep.GetBitmap(), *resample, pixel_size, &allocator);
+  if (result.isNull())
+    return gin::ConvertToV8(isolate, gfx::Size());
+  return gin::ConvertToV8(isolate, pixel_size);
 }
 
 gin::Handle<NativeImage> NativeImage::Crop(v8::Isolate* isolate,
@@ -547,6 +964,87 @@ gin::Handle<NativeImage> NativeImage::CreateFromBuffer(
   return Create(args->isolate(), gfx::Image(image_skia));
 }
 
+// static
+v8::Local<v8::Promise> NativeImage::CreateFromPathAsync(
+    v8::Isolate* isolate,
+    const base::FilePath& path) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+#if BUILDFLAG(IS_WIN)
+  // ICO files are loaded lazily through LoadImage() when an HICON is needed,
+  // so there is nothing to decode up front.
+  if (path.MatchesExtension(FILE_PATH_LITERAL(".ico"))) {
+    promise.Resolve(CreateFromPath(isolate, path).ToV8());
+    return handle;
+  }
+#endif
+
+  ImageJobQueue::GetForCurrentSequence().PostJob(
+      base::BindOnce(
+          [](const base::FilePath& path) {
+            gfx::ImageSkia image_skia;
+            electron::util::PopulateImageSkiaRepsFromPath(&image_skia,
+                                                          NormalizePath(path));
+            return image_skia.image_reps();
+          },
+          path),
+      base::BindOnce(
+          [](gin_helper::Promise<v8::Local<v8::Value>> promise,
+             const base::FilePath& path, ImageSkiaReps reps) {
+            v8::Isolate* isolate = promise.isolate();
+            gin_helper::Locker locker(isolate);
+            v8::HandleScope handle_scope(isolate);
+            v8::Context::Scope context_scope(
+                v8::Local<v8::Context>::New(isolate, promise.GetContext()));
+
+            gin::Handle<NativeImage> image =
+                Create(isolate, ImageFromReps(reps));
+#if BUILDFLAG(IS_MAC)
+            if (IsTemplateFilename(path))
+              image->SetTemplateImage(true);
+#endif
+            promise.Resolve(image.ToV8());
+          },
+          std::move(promise), path));
+  return handle;
+}
+
+// static
+v8::Local<v8::Promise> NativeImage::CreateFromBufferAsync(
+    gin_helper::ErrorThrower thrower,
+    v8::Local<v8::Value> buffer,
+    gin::Arguments* args) {
+  if (!node::Buffer::HasInstance(buffer)) {
+    thrower.ThrowError("buffer must be a node Buffer");
+    return {};
+  }
+
+  int width = 0;
+  int height = 0;
+  double scale_factor = 1.;
+
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("width", &width);
+    options.Get("height", &height);
+    options.Get("scaleFactor", &scale_factor);
+  }
+
+  gin_helper::Promise<gfx::Image> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // Copy the encoded bytes so that the decoder doesn't race with script
+  // writing to, or detaching, the buffer while the job runs.
+  const base::span<const uint8_t> data = electron::Buffer::as_byte_span(buffer);
+  ImageJobQueue::GetForCurrentSequence().PostJob(
+      base::BindOnce(&DecodeImageFromBuffer,
+                     std::vector<uint8_t>(data.begin(), data.end()), width,
+                     height, scale_factor),
+      base::BindOnce(&ResolveWithImageReps, std::move(promise)));
+  return handle;
+}
+
 // static
 gin::Handle<NativeImage> NativeImage::CreateFromDataURL(v8::Isolate* isolate,
                                                         const GURL& url) {
@@ -583,12 +1081,15 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
   return gin::ObjectTemplateBuilder(isolate, GetTypeName(),
                                     constructor->InstanceTemplate())
       .SetMethod("toPNG", &NativeImage::ToPNG)
+      .SetMethod("toPNGAsync", &NativeImage::ToPNGAsync)
       .SetMethod("toJPEG", &NativeImage::ToJPEG)
+      .SetMethod("toJPEGAsync", &NativeImage::ToJPEGAsync)
       .SetMethod("toBitmap", &NativeImage::ToBitmap)
       .SetMethod("getBitmap", &NativeImage::GetBitmap)
       .SetMethod("getScaleFactors", &NativeImage::GetScaleFactors)
       .SetMethod("getNativeHandle", &NativeImage::GetNativeHandle)
       .SetMethod("toDataURL", &NativeImage::ToDataURL)
+      .SetMethod("toDataURLAsync", &NativeImage::ToDataURLAsync)
       .SetMethod("isEmpty", &NativeImage::IsEmpty)
       .SetMethod("getSize", &NativeImage::GetSize)
       .SetMethod("setTemplateImage", &NativeImage::SetTemplateImage)
@@ -596,6 +1097,8 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
       .SetProperty("isMacTemplateImage", &NativeImage::IsTemplateImage,
                    &NativeImage::SetTemplateImage)
       .SetMethod("resize", &NativeImage::Resize)
+      .SetMethod("resizeAsync", &NativeImage::ResizeAsync)
+      .SetMethod("resizeInto", &NativeImage::ResizeInto)
       .SetMethod("crop", &NativeImage::Crop)
       .SetMethod("getAspectRatio", &NativeImage::GetAspectRatio)
       .SetMethod("addRepresentation", &NativeImage::AddRepresentation);
@@ -625,8 +1128,12 @@ void Initialize(v8::Local<v8::Object> exports,
 
   native_image.SetMethod("createEmpty", &NativeImage::CreateEmpty);
   native_image.SetMethod("createFromPath", &NativeImage::CreateFromPath);
+  native_image.SetMethod("createFromPathAsync",
+                         &NativeImage::CreateFromPathAsync);
   native_image.SetMethod("createFromBitmap", &NativeImage::CreateFromBitmap);
   native_image.SetMethod("createFromBuffer", &NativeImage::CreateFromBuffer);
+  native_image.SetMethod("createFromBufferAsync",
+                         &NativeImage::CreateFromBufferAsync);
   native_image.SetMethod("createFromDataURL", &NativeImage::CreateFromDataURL);
   native_image.SetMethod("createFromNamedImage",
                          &NativeImage::CreateFromNamedImage);
@@ -68,6 +68,9 @@ class NativeImage final : public gin::Wrappable<NativeImage> {
       base::span<const uint8_t> data);
   static gin::Handle<NativeImage> CreateFromPath(v8::Isolate* isolate,
                                                  const base::FilePath& path);
+  static v8::Local<v8::Promise> CreateFromPathAsync(
+      v8::Isolate* isolate,
+      const base::FilePath& path);
   static gin::Handle<NativeImage> CreateFromBitmap(
       gin_helper::ErrorThrower thrower,
       v8::Local<v8::Value> buffer,
@@ -76,6 +79,10 @@ class NativeImage final : public gin::Wrappable<NativeImage> {
       gin_helper::ErrorThrower thrower,
       v8::Local<v8::Value> buffer,
       gin::Arguments* args);
+  static v8::Local<v8::Promise> CreateFromBufferAsync(
+      gin_helper::ErrorThrower thrower,
+      v8::Local<v8::Value> buffer,
+      gin::Arguments* args);
   static gin::Handle<NativeImage> CreateFromDataURL(v8::Isolate* isolate,
                                                     const GURL& url);
   static gin::Handle<NativeImage> CreateFromNamedImage(gin::Arguments* args,
@@ -110,12 +117,25 @@ class NativeImage final : public gin::Wrappable<NativeImage> {
  private:
   v8::Local<v8::Value> ToPNG(gin::Arguments* args);
   v8::Local<v8::Value> ToJPEG(v8::Isolate* isolate, int quality);
+  // Variants of the above that encode on the thread pool.
+  v8::Local<v8::Promise> ToPNGAsync(gin::Arguments* args);
+  v8::Local<v8::Promise> ToJPEGAsync(v8::Isolate* isolate, int quality);
+  v8::Local<v8::Promise> ToDataURLAsync(gin::Arguments* args);
   v8::Local<v8::Value> ToBitmap(gin::Arguments* args);
   std::vector<float> GetScaleFactors();
   v8::Local<v8::Value> GetBitmap(gin::Arguments* args);
   v8::Local<v8::Value> GetNativeHandle(gin_helper::ErrorThrower thrower);
   gin::Handle<NativeImage> Resize(gin::Arguments* args,
                                   base::Value::Dict options);
+  v8::Local<v8::Promise> ResizeAsync(gin::Arguments* args,
+                                     base::Value::Dict options);
+  // Resamples a single representation into the pixels of |buffer|.
+  v8::Local<v8::Value> ResizeInto(v8::Isolate* isolate,
+                                  v8::Local<v8::Value> buffer,
+                                  base::Value::Dict options);
+  // Returns the target size of a resize, or nullopt for an empty result.
+  std::optional<gfx::Size> GetResizedSize(float scale_factor,
+                                          const base::Value::Dict& options);
   gin::Handle<NativeImage> Crop(v8::Isolate* isolate, const gfx::Rect& rect);
   std::string ToDataURL(gin::Arguments* args);
   bool IsEmpty();
@@ -2,11 +2,18 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <memory>
+#include <utility>
+
 #include "base/command_line.h"
 #include "base/dcheck_is_on.h"
+#include "base/functional/bind.h"
 #include "base/logging.h"
+#include "base/task/single_thread_task_runner.h"
+#include "base/time/time.h"
 #include "content/public/common/content_switches.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "v8/include/v8.h"
 
@@ -41,6 +48,53 @@ std::string GetLoggingDestination() {
   return command_line->GetSwitchValueASCII(switches::kEnableLogging);
 }
 
+struct PostTasksState {
+  explicit PostTasksState(gin_helper::Promise<double> promise)
+      : promise(std::move(promise)) {}
+
+  gin_helper::Promise<double> promise;
+  const base::TimeTicks start = base::TimeTicks::Now();
+  int ran = 0;
+  bool in_order = true;
+};
+
+void RunPostedTask(std::shared_ptr<PostTasksState> state,
+                   int index,
+                   int count) {
+  state->in_order &= index == state->ran;
+  if (++state->ran < count)
+    return;
+  if (state->in_order) {
+    state->promise.Resolve(
+        (base::TimeTicks::Now() - state->start).InMillisecondsF());
+  } else {
+    state->promise.RejectWithErrorMessage("Tasks ran out of order");
+  }
+}
+
+// Posts |count| tasks with the same |delay_ms| to the current thread's task
+// runner. Resolves with the milliseconds it took to post and run them all,
+// or rejects if they didn't run in the order they were posted in.
+v8::Local<v8::Promise> PostTasks(v8::Isolate* isolate,
+                                 int count,
+                                 double delay_ms) {
+  gin_helper::Promise<double> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  if (count <= 0) {
+    promise.Resolve(0);
+    return handle;
+  }
+
+  auto state = std::make_shared<PostTasksState>(std::move(promise));
+  auto task_runner = base::SingleThreadTaskRunner::GetCurrentDefault();
+  for (int i = 0; i < count; ++i) {
+    task_runner->PostDelayedTask(
+        FROM_HERE, base::BindOnce(&RunPostedTask, state, i, count),
+        base::Milliseconds(delay_ms));
+  }
+  return handle;
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -48,6 +102,7 @@ void Initialize(v8::Local<v8::Object> exports,
   gin_helper::Dictionary dict(context->GetIsolate(), exports);
   dict.SetMethod("log", &Log);
   dict.SetMethod("getLoggingDestination", &GetLoggingDestination);
+  dict.SetMethod("postTasks", &PostTasks);
 }
 
 }  // namespace
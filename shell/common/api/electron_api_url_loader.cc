@@ -5,7 +5,9 @@
 #include "shell/common/api/electron_api_url_loader.h"
 
 #include <algorithm>
+#include <array>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -14,9 +16,16 @@
 #include "base/check_op.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/containers/span.h"
+#include "base/files/file.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/raw_span.h"
 #include "base/notreached.h"
 #include "base/sequence_checker.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
+#include "crypto/hash.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
 #include "gin/wrappable.h"
@@ -24,6 +33,8 @@
 #include "mojo/public/cpp/system/data_pipe_producer.h"
 #include "net/base/auth.h"
 #include "net/base/load_flags.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_request_headers.h"
 #include "net/http/http_util.h"
 #include "net/url_request/redirect_util.h"
 #include "services/network/public/cpp/resource_request.h"
@@ -41,6 +52,7 @@
 #include "shell/browser/net/proxying_url_loader_factory.h"
 #include "shell/browser/protocol_registry.h"
 #include "shell/common/gin_converters/callback_converter.h"
+#include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/gurl_converter.h"
 #include "shell/common/gin_converters/net_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -48,6 +60,7 @@
 #include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/process_util.h"
+#include "shell/common/v8_util.h"
 #include "shell/services/node/node_service.h"
 #include "third_party/blink/public/common/loader/referrer_utils.h"
 #include "third_party/blink/public/mojom/fetch/fetch_api_request.mojom.h"
@@ -142,26 +155,31 @@ auto ToVec(v8::Local<v8::ArrayBufferView> view) {
   return buf;
 }
 
+// Writes the contents of an ArrayBufferView to a data pipe. The view's backing
+// store is kept alive instead of copying the contents out of V8, so the view
+// must not be modified until the write has completed.
 class BufferDataSource : public mojo::DataPipeProducer::DataSource {
  public:
   explicit BufferDataSource(v8::Local<v8::ArrayBufferView> buffer)
-      : buffer_{ToVec<char>(buffer)} {}
+      : backing_store_{buffer->Buffer()->GetBackingStore()},
+        data_{util::as_byte_span(buffer)} {}
 
   ~BufferDataSource() override = default;
 
  private:
   // mojo::DataPipeProducer::DataSource:
-  [[nodiscard]] uint64_t GetLength() const override { return buffer_.size(); }
+  [[nodiscard]] uint64_t GetLength() const override { return data_.size(); }
   ReadResult Read(uint64_t offset, base::span<char> tgt) override {
-    CHECK_LE(offset, buffer_.size());
-    const auto src =
-        base::span<const char>{buffer_}.subspan(static_cast<size_t>(offset));
+    CHECK_LE(offset, data_.size());
+    const auto src = base::as_chars(
+        base::span<const uint8_t>{data_}.subspan(static_cast<size_t>(offset)));
     const auto n_copied = std::min(src.size(), tgt.size());
     tgt.first(n_copied).copy_from(src.first(n_copied));
     return ReadResult{.bytes_read = n_copied};
   }
 
-  std::vector<char> buffer_;
+  std::shared_ptr<v8::BackingStore> backing_store_;
+  base::raw_span<const uint8_t> data_;
 };
 
 class JSChunkedDataPipeGetter final
@@ -318,8 +336,106 @@ const net::NetworkTrafficAnnotationTag kTrafficAnnotation =
           setting: "This feature cannot be disabled."
         })");
 
+// How often download progress is reported while saving to a file.
+constexpr base::TimeDelta kSaveToFileProgressInterval = base::Milliseconds(100);
+
 }  // namespace
 
+// Writes the response body to a file on a thread pool sequence, hashing it
+// along the way. Errors are sticky: once a write fails, every later call
+// reports the same error.
+class SimpleURLLoaderWrapper::FileWriter {
+ public:
+  // When |offset| is non-zero the download is resumed, so the file is kept up
+  // to |offset| and that part is hashed before anything is appended.
+  FileWriter(const base::FilePath& path, bool hash, uint64_t offset)
+      : file_(path,
+              base::File::FLAG_OPEN_ALWAYS | base::File::FLAG_READ |
+                  base::File::FLAG_WRITE) {
+    if (!file_.IsValid()) {
+      net_error_ = net::FileErrorToNetError(file_.error_details());
+      return;
+    }
+    if (hash)
+      hasher_.emplace(crypto::hash::kSha256);
+    if (offset > 0 && !HashExistingContents(offset))
+      return;
+    if (!file_.SetLength(offset) ||
+        file_.Seek(base::File::FROM_BEGIN, offset) !=
+            static_cast<int64_t>(offset)) {
+      SetError();
+      return;
+    }
+    size_ = offset;
+  }
+
+  // disable copy
+  FileWriter(const FileWriter&) = delete;
+  FileWriter& operator=(const FileWriter&) = delete;
+
+  int Write(const std::string& data) {
+    if (net_error_ != net::OK)
+      return net_error_;
+    const auto bytes = base::as_byte_span(data);
+    if (!file_.WriteAtCurrentPosAndCheck(bytes)) {
+      SetError();
+      return net_error_;
+    }
+    if (hasher_)
+      hasher_->Update(bytes);
+    size_ += bytes.size();
+    return net::OK;
+  }
+
+  SavedFile Finish() {
+    SavedFile saved_file{.net_error = net_error_, .size = size_};
+    if (net_error_ == net::OK && hasher_) {
+      auto digest = std::array<uint8_t, crypto::hash::kSha256Size>{};
+      hasher_->Finish(digest);
+      saved_file.hash = base::ToLowerASCII(base::HexEncode(digest));
+    }
+    hasher_.reset();
+    file_.Close();
+    return saved_file;
+  }
+
+ private:
+  bool HashExistingContents(uint64_t offset) {
+    if (file_.GetLength() < static_cast<int64_t>(offset)) {
+      // There is less on disk than the caller asked to resume from.
+      net_error_ = net::ERR_INVALID_ARGUMENT;
+      return false;
+    }
+    if (!hasher_)
+      return true;
+    std::vector<uint8_t> buffer(
+        static_cast<size_t>(std::min<uint64_t>(offset, 1024 * 1024)));
+    for (uint64_t position = 0; position < offset;) {
+      auto chunk = base::span(buffer).first(
+          static_cast<size_t>(std::min<uint64_t>(buffer.size(),
+                                                 offset - position)));
+      if (!file_.ReadAndCheck(position, chunk)) {
+        SetError();
+        return false;
+      }
+      hasher_->Update(chunk);
+      position += chunk.size();
+    }
+    return true;
+  }
+
+  void SetError() {
+    net_error_ = net::FileErrorToNetError(base::File::GetLastFileError());
+    if (net_error_ == net::OK)
+      net_error_ = net::ERR_FAILED;
+  }
+
+  base::File file_;
+  std::optional<crypto::hash::Hasher> hasher_;
+  uint64_t size_ = 0;
+  int net_error_ = net::OK;
+};
+
 gin::WrapperInfo SimpleURLLoaderWrapper::kWrapperInfo = {
     gin::kEmbedderNativeGin};
 
@@ -504,12 +620,11 @@ SimpleURLLoaderWrapper::GetURLLoaderFactoryForURL(const GURL& url) {
                                                protocol_handler->second)));
     }
 
-    if (const auto* const protocol_handler =
-            protocol_registry->FindRegistered(scheme)) {
+    if (auto factory =
+            protocol_registry->CreateRegisteredURLLoaderFactory(scheme)) {
       return network::SharedURLLoaderFactory::Create(
           std::make_unique<network::WrapperPendingSharedURLLoaderFactory>(
-              ElectronURLLoaderFactory::Create(protocol_handler->first,
-                                               protocol_handler->second)));
+              std::move(factory)));
     }
   }
 
@@ -670,6 +785,32 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
   if (opts.ValueOrDefault("bypassCustomProtocolHandlers", false))
     options |= kBypassCustomProtocolHandlers;
 
+  std::optional<SaveToFileOptions> save_to_file;
+  if (gin_helper::Dictionary save_opts; opts.Get("saveToFile", &save_opts)) {
+    save_to_file.emplace();
+    if (!save_opts.Get("path", &save_to_file->path) ||
+        !save_to_file->path.IsAbsolute()) {
+      args->ThrowTypeError("saveToFile.path must be an absolute path");
+      return {};
+    }
+    if (std::string hash; save_opts.Get("hash", &hash)) {
+      if (hash != "sha256") {
+        args->ThrowTypeError("Unsupported saveToFile.hash: " + hash);
+        return {};
+      }
+      save_to_file->hash = true;
+    }
+    save_opts.Get("resumeFrom", &save_to_file->resume_from);
+    if (save_to_file->resume_from > 0 &&
+        !request->headers.HasHeader(net::HttpRequestHeaders::kRange)) {
+      request->headers.SetHeader(
+          net::HttpRequestHeaders::kRange,
+          base::StrCat(
+              {"bytes=", base::NumberToString(save_to_file->resume_from),
+               "-"}));
+    }
+  }
+
   v8::Local<v8::Value> body;
   v8::Local<v8::Value> chunk_pipe_getter;
   if (opts.Get("body", &body)) {
@@ -711,6 +852,7 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
   auto ret = gin::CreateHandle(
       args->isolate(),
       new SimpleURLLoaderWrapper(browser_context, std::move(request), options));
+  ret->save_to_file_ = std::move(save_to_file);
   ret->Pin();
   if (!chunk_pipe_getter.IsEmpty()) {
     ret->PinBodyGetter(chunk_pipe_getter);
@@ -721,16 +863,39 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
 void SimpleURLLoaderWrapper::OnDataReceived(std::string_view string_view,
                                             base::OnceClosure resume) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (file_writer_) {
+    // The next chunk is only read once this one is on disk, which bounds the
+    // memory used by a download to a single chunk.
+    file_writer_.AsyncCall(&FileWriter::Write)
+        .WithArgs(std::string(string_view))
+        .Then(base::BindOnce(&SimpleURLLoaderWrapper::OnChunkSaved,
+                             weak_factory_.GetWeakPtr(), std::move(resume)));
+    return;
+  }
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
-  auto array_buffer = v8::ArrayBuffer::New(isolate, string_view.size());
+  // Each chunk gets an ArrayBuffer of its own, so that a chunk retained by JS
+  // doesn't keep any other memory alive. It is fully overwritten below, so
+  // there is no point in zeroing it first.
+  std::unique_ptr<v8::BackingStore> backing_store =
+      v8::ArrayBuffer::NewBackingStore(
+          isolate, string_view.size(),
+          v8::BackingStoreInitializationMode::kUninitialized);
   // TODO SAFETY: migrate this to shell/common/v8_util.h
-  UNSAFE_BUFFERS(
-      std::ranges::copy(string_view, static_cast<char*>(array_buffer->Data())));
-  Emit("data", array_buffer, std::move(resume));
+  UNSAFE_BUFFERS(std::ranges::copy(
+      string_view, static_cast<char*>(backing_store->Data())));
+  Emit("data", v8::ArrayBuffer::New(isolate, std::move(backing_store)),
+       std::move(resume));
 }
 
 void SimpleURLLoaderWrapper::OnComplete(bool success) {
+  if (success && file_writer_) {
+    file_writer_.AsyncCall(&FileWriter::Finish)
+        .Then(base::BindOnce(&SimpleURLLoaderWrapper::OnFileSaved,
+                             weak_factory_.GetWeakPtr()));
+    return;
+  }
+  file_writer_.Reset();
   auto self = weak_factory_.GetWeakPtr();
   if (success) {
     Emit("complete");
@@ -746,6 +911,57 @@ void SimpleURLLoaderWrapper::OnComplete(bool success) {
   }
 }
 
+void SimpleURLLoaderWrapper::OnChunkSaved(base::OnceClosure resume,
+                                          int net_error) {
+  if (net_error != net::OK) {
+    FailSaveToFile(net_error);
+    return;
+  }
+  std::move(resume).Run();
+}
+
+void SimpleURLLoaderWrapper::OnFileSaved(SavedFile saved_file) {
+  file_writer_.Reset();
+  if (saved_file.net_error != net::OK) {
+    FailSaveToFile(saved_file.net_error);
+    return;
+  }
+  auto self = weak_factory_.GetWeakPtr();
+  // Throttling may have held back the last progress, which reports the whole
+  // body.
+  if (pending_download_progress_) {
+    Emit("download-progress", *std::exchange(pending_download_progress_,
+                                             std::nullopt));
+    // The request may have been cancelled from the "download-progress" event.
+    if (!self || !loader_)
+      return;
+  }
+  {
+    v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+    v8::HandleScope scope(isolate);
+    auto dict = gin::Dictionary::CreateEmpty(isolate);
+    dict.Set("path", save_to_file_->path);
+    dict.Set("size", static_cast<double>(saved_file.size));
+    if (!saved_file.hash.empty())
+      dict.Set("hash", saved_file.hash);
+    Emit("saved", dict);
+  }
+  // The request may have been cancelled from the "saved" event.
+  if (self && loader_)
+    OnComplete(true);
+}
+
+void SimpleURLLoaderWrapper::FailSaveToFile(int net_error) {
+  file_writer_.Reset();
+  loader_.reset();
+  auto self = weak_factory_.GetWeakPtr();
+  Emit("error", net::ErrorToString(net_error));
+  if (self) {
+    pinned_wrapper_.Reset();
+    pinned_chunk_pipe_getter_.Reset();
+  }
+}
+
 void SimpleURLLoaderWrapper::OnResponseStarted(
     const GURL& final_url,
     const network::mojom::URLResponseHead& response_head) {
@@ -759,6 +975,30 @@ void SimpleURLLoaderWrapper::OnResponseStarted(
   dict.Set("rawHeaders", response_head.raw_response_headers);
   dict.Set("mimeType", response_head.mime_type);
   Emit("response-started", final_url, dict);
+
+  // Only successful responses are saved, so that an error page doesn't
+  // overwrite a partial download. Other bodies are emitted as usual.
+  const int status = response_head.headers->response_code();
+  if (!save_to_file_ || !loader_ || status < 200 || status >= 300)
+    return;
+  uint64_t offset = 0;
+  if (status == 206 && save_to_file_->resume_from > 0) {
+    int64_t first_byte = 0, last_byte = 0, length = 0;
+    if (!response_head.headers->GetContentRangeFor206(&first_byte, &last_byte,
+                                                      &length) ||
+        static_cast<uint64_t>(first_byte) != save_to_file_->resume_from) {
+      FailSaveToFile(net::ERR_INVALID_RESPONSE);
+      return;
+    }
+    offset = save_to_file_->resume_from;
+  }
+  // A server that ignores the range sends the whole body, which replaces
+  // what was saved before.
+  file_writer_ = base::SequenceBound<FileWriter>(
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}),
+      save_to_file_->path, save_to_file_->hash, offset);
 }
 
 void SimpleURLLoaderWrapper::OnRedirect(
@@ -814,6 +1054,15 @@ void SimpleURLLoaderWrapper::OnUploadProgress(uint64_t position,
 }
 
 void SimpleURLLoaderWrapper::OnDownloadProgress(uint64_t current) {
+  if (file_writer_) {
+    const base::TimeTicks now = base::TimeTicks::Now();
+    if (now - last_download_progress_time_ < kSaveToFileProgressInterval) {
+      pending_download_progress_ = current;
+      return;
+    }
+    last_download_progress_time_ = now;
+    pending_download_progress_.reset();
+  }
   Emit("download-progress", current);
 }
 
@@ -6,13 +6,17 @@
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_URL_LOADER_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
+#include "base/threading/sequence_bound.h"
+#include "base/time/time.h"
 #include "gin/wrappable.h"
 #include "mojo/public/cpp/bindings/receiver_set.h"
 #include "services/network/public/cpp/simple_url_loader_stream_consumer.h"
@@ -70,6 +74,21 @@ class SimpleURLLoaderWrapper final
   void WillBeDestroyed() override;
 
  private:
+  class FileWriter;
+
+  struct SaveToFileOptions {
+    base::FilePath path;
+    bool hash = false;
+    uint64_t resume_from = 0;
+  };
+
+  struct SavedFile {
+    int net_error = 0;
+    uint64_t size = 0;
+    // Lowercase hex digest, empty unless a hash was requested.
+    std::string hash;
+  };
+
   SimpleURLLoaderWrapper(ElectronBrowserContext* browser_context,
                          std::unique_ptr<network::ResourceRequest> request,
                          int options);
@@ -153,6 +172,11 @@ class SimpleURLLoaderWrapper final
   void OnUploadProgress(uint64_t position, uint64_t total);
   void OnDownloadProgress(uint64_t current);
 
+  // Saving the response body to a file.
+  void OnChunkSaved(base::OnceClosure resume, int net_error);
+  void OnFileSaved(SavedFile saved_file);
+  void FailSaveToFile(int net_error);
+
   void Start();
   void Pin();
   void PinBodyGetter(v8::Local<v8::Value>);
@@ -166,6 +190,14 @@ class SimpleURLLoaderWrapper final
   v8::Global<v8::Value> pinned_wrapper_;
   v8::Global<v8::Value> pinned_chunk_pipe_getter_;
 
+  // Set when the response body is written to a file rather than emitted.
+  // |file_writer_| only exists once a successful response has started.
+  std::optional<SaveToFileOptions> save_to_file_;
+  base::SequenceBound<FileWriter> file_writer_;
+  base::TimeTicks last_download_progress_time_;
+  // The latest download progress that throttling held back.
+  std::optional<uint64_t> pending_download_progress_;
+
   mojo::ReceiverSet<network::mojom::URLLoaderNetworkServiceObserver>
       url_loader_network_observer_receivers_;
   base::WeakPtrFactory<SimpleURLLoaderWrapper> weak_factory_{this};
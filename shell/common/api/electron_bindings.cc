@@ -9,11 +9,11 @@
 #include <utility>
 #include <vector>
 
-#include "base/containers/contains.h"
 #include "base/files/file.h"
 #include "base/process/process.h"
 #include "base/process/process_handle.h"
 #include "base/system/sys_info.h"
+#include "base/trace_event/trace_event.h"
 #include "electron/mas.h"
 #include "services/resource_coordinator/public/cpp/memory_instrumentation/global_memory_dump.h"
 #include "services/resource_coordinator/public/cpp/memory_instrumentation/memory_instrumentation.h"
@@ -84,30 +84,67 @@ void ElectronBindings::BindTo(v8::Isolate* isolate,
 }
 
 void ElectronBindings::EnvironmentDestroyed(node::Environment* env) {
-  std::erase(pending_next_ticks_, env);
+  if (pending_next_tick_set_.erase(env))
+    std::erase(pending_next_ticks_, env);
+  std::ranges::replace(running_next_ticks_, env, nullptr);
 }
 
 void ElectronBindings::ActivateUVLoop(v8::Isolate* isolate) {
   node::Environment* env = node::Environment::GetCurrent(isolate);
-  if (base::Contains(pending_next_ticks_, env))
+  if (!pending_next_tick_set_.insert(env).second)
     return;
 
   pending_next_ticks_.push_back(env);
-  uv_async_send(call_next_tick_async_.get());
+  // The async handle is already pending for the rest of the batch.
+  if (pending_next_ticks_.size() == 1)
+    uv_async_send(call_next_tick_async_.get());
 }
 
 // static
 void ElectronBindings::OnCallNextTick(uv_async_t* handle) {
   auto* self = static_cast<ElectronBindings*>(handle->data);
-  for (auto* env : self->pending_next_ticks_) {
-    gin_helper::Locker locker(env->isolate());
-    v8::Context::Scope context_scope(env->context());
-    v8::HandleScope handle_scope(env->isolate());
-    node::CallbackScope scope(env->isolate(), v8::Object::New(env->isolate()),
-                              {0, 0});
+  TRACE_COUNTER1("electron", "ElectronBindings::NextTickWakeups",
+                 ++self->next_tick_wakeups_);
+
+  // Take the whole batch, so that environments asking again while it runs
+  // get another wakeup.
+  auto& batch = self->running_next_ticks_;
+  DCHECK(batch.empty());
+  batch.swap(self->pending_next_ticks_);
+  self->pending_next_tick_set_.clear();
+
+  // The frames of a renderer share an isolate, so consecutive environments
+  // share the lock and handle scope. Environments without a tick or
+  // rejection pending are skipped, the uv loop has already been woken up for
+  // their immediates.
+  size_t i = 0;
+  while (i < batch.size()) {
+    if (!batch[i]) {
+      ++i;
+      continue;
+    }
+    v8::Isolate* isolate = batch[i]->isolate();
+    gin_helper::Locker locker(isolate);
+    v8::HandleScope handle_scope(isolate);
+    for (; i < batch.size(); ++i) {
+      node::Environment* env = batch[i];
+      if (!env || !env->can_call_into_js())
+        continue;
+      if (env->isolate() != isolate)
+        break;
+      node::TickInfo* tick_info = env->tick_info();
+      if (!tick_info->has_tick_scheduled() &&
+          !tick_info->has_rejection_to_warn())
+        continue;
+      v8::Context::Scope context_scope(env->context());
+      node::CallbackScope scope(isolate, env->process_object(), {0, 0});
+      ++self->next_tick_checkpoints_;
+    }
   }
+  batch.clear();
 
-  self->pending_next_ticks_.clear();
+  TRACE_COUNTER1("electron", "ElectronBindings::NextTickCheckpoints",
+                 self->next_tick_checkpoints_);
 }
 
 // static
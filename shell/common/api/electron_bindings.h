@@ -5,12 +5,14 @@
 #ifndef ELECTRON_SHELL_COMMON_API_ELECTRON_BINDINGS_H_
 #define ELECTRON_SHELL_COMMON_API_ELECTRON_BINDINGS_H_
 
-#include <list>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "base/memory/scoped_refptr.h"
 #include "base/process/process_metrics.h"
 #include "shell/common/node_bindings.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_set.h"
 #include "uv.h"  // NOLINT(build/include_directory)
 
 namespace base {
@@ -81,7 +83,15 @@ class ElectronBindings {
   static void OnCallNextTick(uv_async_t* handle);
 
   UvHandle<uv_async_t> call_next_tick_async_;
-  std::list<node::Environment*> pending_next_ticks_;
+  // Environments that asked for the uv loop to be activated, in the order
+  // they asked. |pending_next_tick_set_| indexes the same environments.
+  std::vector<node::Environment*> pending_next_ticks_;
+  absl::flat_hash_set<node::Environment*> pending_next_tick_set_;
+  // The environments being processed by OnCallNextTick(). Destroyed ones are
+  // replaced with nullptr.
+  std::vector<node::Environment*> running_next_ticks_;
+  uint64_t next_tick_wakeups_ = 0;
+  uint64_t next_tick_checkpoints_ = 0;
   std::unique_ptr<base::ProcessMetrics> metrics_;
 };
 
@@ -17,7 +17,9 @@
 #include "base/logging.h"
 #include "base/pickle.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "base/values.h"
+#include "crypto/hash.h"
 #include "electron/fuses.h"
 #include "shell/common/asar/asar_util.h"
 #include "shell/common/asar/scoped_temporary_file.h"
@@ -266,6 +268,20 @@ bool Archive::Init() {
   return true;
 }
 
+std::optional<std::string> Archive::HeaderHash() {
+  if (!header_)
+    return std::nullopt;
+
+  // The header is not kept around after parsing, so read it again.
+  std::vector<uint8_t> buf(header_size_ - 8);
+  {
+    electron::ScopedAllowBlockingForElectron allow_blocking;
+    if (!file_.ReadAndCheck(8, buf))
+      return std::nullopt;
+  }
+  return base::ToLowerASCII(base::HexEncode(crypto::hash::Sha256(buf)));
+}
+
 #if !BUILDFLAG(IS_MAC) && !BUILDFLAG(IS_WIN)
 std::optional<IntegrityPayload> Archive::HeaderIntegrity() const {
   return std::nullopt;
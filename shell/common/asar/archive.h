@@ -74,6 +74,10 @@ class Archive {
   std::optional<IntegrityPayload> HeaderIntegrity() const;
   std::optional<base::FilePath> RelativePath() const;
 
+  // Returns the hex-encoded SHA-256 hash of the header, which identifies the
+  // layout of the files in the archive.
+  std::optional<std::string> HeaderHash();
+
   // Get the info of a file.
   bool GetFileInfo(const base::FilePath& path, FileInfo* info) const;
 
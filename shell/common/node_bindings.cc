@@ -469,17 +469,20 @@ NodeBindings::NodeBindings(BrowserEnvironment browser_env)
       uv_loop_{InitEventLoop(browser_env, &worker_loop_)} {}
 
 NodeBindings::~NodeBindings() {
-  // Quit the embed thread.
-  embed_closed_ = true;
-  uv_sem_post(&embed_sem_);
+  if (embed_thread_started_) {
+    // Quit the embed thread.
+    embed_closed_ = true;
+    uv_sem_post(&embed_sem_);
+
+    WakeupEmbedThread();
 
-  WakeupEmbedThread();
+    // Wait for everything to be done.
+    uv_thread_join(&embed_thread_);
 
-  // Wait for everything to be done.
-  uv_thread_join(&embed_thread_);
+    uv_sem_destroy(&embed_sem_);
+  }
 
   // Clear uv.
-  uv_sem_destroy(&embed_sem_);
   dummy_uv_handle_.reset();
 
   // Clean up worker loop
@@ -860,9 +863,17 @@ void NodeBindings::PrepareEmbedThread() {
   // nothing to do.
   uv_async_init(uv_loop_, dummy_uv_handle_.get(), nullptr);
 
+  // Dispatch uv events from the message pump where possible, which saves a
+  // thread hop and a semaphore round trip per event.
+  if (CanWatchEventsOnCurrentThread()) {
+    watching_events_ = true;
+    return;
+  }
+
   // Start worker that will interrupt main loop when having uv events.
   uv_sem_init(&embed_sem_, 0);
   uv_thread_create(&embed_thread_, EmbedThreadRunner, this);
+  embed_thread_started_ = true;
 }
 
 void NodeBindings::StartPolling() {
@@ -877,6 +888,9 @@ void NodeBindings::StartPolling() {
   // The MessageLoop should have been created, remember the one in main thread.
   task_runner_ = base::SingleThreadTaskRunner::GetCurrentDefault();
 
+  if (watching_events_)
+    StartWatchingEvents();
+
   // Run uv loop for once to give the uv__io_poll a chance to add all events.
   UvRunOnce();
 }
@@ -918,8 +932,13 @@ void NodeBindings::UvRunOnce() {
   // When doing navigation without restarting renderer process, it may happen
   // that the node environment is destroyed but the message loop is still there.
   // In this case we should not run uv loop.
-  if (!env)
+  if (!env) {
+    // Like the embed thread, which is left waiting, stop dispatching events
+    // so that pending ones don't keep waking up the message pump.
+    if (watching_events_)
+      StopWatchingEvents();
     return;
+  }
 
   v8::HandleScope handle_scope(env->isolate());
 
@@ -943,6 +962,11 @@ void NodeBindings::UvRunOnce() {
       base::RunLoop().QuitWhenIdle();  // Quit from uv.
   }
 
+  if (watching_events_) {
+    OnUvRunOnceDone();
+    return;
+  }
+
   // Tell the worker thread to continue polling.
   uv_sem_post(&embed_sem_);
 }
@@ -177,6 +177,25 @@ class NodeBindings {
   // Called to poll events in new thread.
   virtual void PollEvents() = 0;
 
+  // Whether uv events can be dispatched by the current thread's message pump
+  // instead of being polled on the embed thread. When this returns true,
+  // StartWatchingEvents() and OnUvRunOnceDone() are used instead of
+  // PollEvents().
+  virtual bool CanWatchEventsOnCurrentThread() { return false; }
+
+  // Starts watching the uv loop for events from the message pump.
+  virtual void StartWatchingEvents() {}
+
+  // Stops watching the uv loop, e.g. when its environment is gone.
+  virtual void StopWatchingEvents() {}
+
+  // Called after the uv loop ran while events are watched by the message
+  // pump, to wait for its next timer.
+  virtual void OnUvRunOnceDone() {}
+
+  // Run the libuv loop for once.
+  void UvRunOnce();
+
   // Make the main thread run libuv loop.
   void WakeupMainThread();
 
@@ -187,9 +206,6 @@ class NodeBindings {
   static uv_loop_t* InitEventLoop(BrowserEnvironment browser_env,
                                   uv_loop_t* worker_loop);
 
-  // Run the libuv loop for once.
-  void UvRunOnce();
-
   [[nodiscard]] constexpr bool in_worker_loop() const {
     return browser_env_ == BrowserEnvironment::kWorker;
   }
@@ -230,6 +246,13 @@ class NodeBindings {
   // Whether the libuv loop has ended.
   bool embed_closed_ = false;
 
+  // Whether the embed thread was created. It isn't when uv events are
+  // dispatched by the message pump.
+  bool embed_thread_started_ = false;
+
+  // Whether uv events are dispatched by the message pump.
+  bool watching_events_ = false;
+
   // Dummy handle to make uv's loop not quit.
   UvHandle<uv_async_t> dummy_uv_handle_;
 
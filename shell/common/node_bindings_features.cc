@@ -0,0 +1,11 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/node_bindings_features.h"
+
+namespace features {
+BASE_FEATURE(kWatchUvBackendFd,
+             "WatchUvBackendFd",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+}  // namespace features
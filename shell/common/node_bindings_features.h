@@ -0,0 +1,16 @@
+// Copyright (c) 2025 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_NODE_BINDINGS_FEATURES_H_
+#define ELECTRON_SHELL_COMMON_NODE_BINDINGS_FEATURES_H_
+
+#include "base/feature_list.h"
+
+namespace features {
+// Dispatches uv events from the message pump of the browser's main thread
+// instead of polling for them on a separate thread.
+BASE_DECLARE_FEATURE(kWatchUvBackendFd);
+}  // namespace features
+
+#endif  // ELECTRON_SHELL_COMMON_NODE_BINDINGS_FEATURES_H_
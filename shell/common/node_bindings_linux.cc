@@ -6,6 +6,13 @@
 
 #include <sys/epoll.h>
 
+#include "base/feature_list.h"
+#include "base/functional/bind.h"
+#include "base/location.h"
+#include "base/task/current_thread.h"
+#include "base/time/time.h"
+#include "shell/common/node_bindings_features.h"
+
 namespace electron {
 
 NodeBindingsLinux::NodeBindingsLinux(BrowserEnvironment browser_env)
@@ -19,6 +26,10 @@ NodeBindingsLinux::NodeBindingsLinux(BrowserEnvironment browser_env)
   epoll_ctl(epoll_, EPOLL_CTL_ADD, backend_fd, &ev);
 }
 
+NodeBindingsLinux::~NodeBindingsLinux() {
+  StopWatchingEvents();
+}
+
 void NodeBindingsLinux::PollEvents() {
   auto* const event_loop = uv_loop();
 
@@ -32,6 +43,71 @@ void NodeBindingsLinux::PollEvents() {
   } while (r == -1 && errno == EINTR);
 }
 
+bool NodeBindingsLinux::CanWatchEventsOnCurrentThread() {
+  // Only the browser's main thread runs a message pump that can watch file
+  // descriptors; renderers, utility processes and workers use the default
+  // pump.
+  return base::FeatureList::IsEnabled(features::kWatchUvBackendFd) &&
+         base::CurrentUIThread::IsSet();
+}
+
+void NodeBindingsLinux::StartWatchingEvents() {
+  fd_controller_.emplace(FROM_HERE);
+  WatchBackendFd();
+}
+
+void NodeBindingsLinux::StopWatchingEvents() {
+  uv_timer_.Stop();
+  fd_controller_.reset();
+  fd_watched_ = false;
+}
+
+void NodeBindingsLinux::WatchBackendFd() {
+  // uv's backend fd is an epoll fd itself, which becomes readable whenever
+  // uv has I/O to process, including uv_async_send() from other threads.
+  fd_watched_ = base::CurrentUIThread::Get()->WatchFileDescriptor(
+      uv_backend_fd(uv_loop()), /*persistent=*/true,
+      base::MessagePumpForUI::WATCH_READ, &*fd_controller_, this);
+}
+
+void NodeBindingsLinux::RunUvLoop() {
+  // JS can spin a nested run loop, e.g. for a modal dialog or a sync IPC,
+  // from which the watcher and the timer fire again. uv_run() must not be
+  // re-entered, so stop watching until the outer run is done, the way the
+  // embed thread waits for UvRunOnce() to return before polling again.
+  if (in_uv_run_) {
+    if (fd_controller_ && fd_watched_) {
+      fd_controller_->StopWatchingFileDescriptor();
+      fd_watched_ = false;
+    }
+    return;
+  }
+
+  in_uv_run_ = true;
+  UvRunOnce();
+  in_uv_run_ = false;
+}
+
+void NodeBindingsLinux::OnUvRunOnceDone() {
+  if (!fd_watched_)
+    WatchBackendFd();
+
+  // Timers don't make the backend fd readable, so wake up for the next one
+  // ourselves. A timeout of 0 means that uv has more work to do right away.
+  const int timeout = uv_backend_timeout(uv_loop());
+  if (timeout < 0) {
+    uv_timer_.Stop();
+    return;
+  }
+  uv_timer_.Start(FROM_HERE, base::Milliseconds(timeout),
+                  base::BindOnce(&NodeBindingsLinux::RunUvLoop,
+                                 base::Unretained(this)));
+}
+
+void NodeBindingsLinux::OnFileCanReadWithoutBlocking(int fd) {
+  RunUvLoop();
+}
+
 // static
 std::unique_ptr<NodeBindings> NodeBindings::Create(BrowserEnvironment env) {
   return std::make_unique<NodeBindingsLinux>(env);
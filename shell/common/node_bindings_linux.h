@@ -5,20 +5,47 @@
 #ifndef ELECTRON_SHELL_COMMON_NODE_BINDINGS_LINUX_H_
 #define ELECTRON_SHELL_COMMON_NODE_BINDINGS_LINUX_H_
 
+#include <optional>
+
+#include "base/message_loop/message_pump_for_ui.h"
+#include "base/timer/timer.h"
 #include "shell/common/node_bindings.h"
 
 namespace electron {
 
-class NodeBindingsLinux : public NodeBindings {
+class NodeBindingsLinux : public NodeBindings,
+                          private base::MessagePumpForUI::FdWatcher {
  public:
   explicit NodeBindingsLinux(BrowserEnvironment browser_env);
+  ~NodeBindingsLinux() override;
 
  private:
   // NodeBindings
   void PollEvents() override;
+  bool CanWatchEventsOnCurrentThread() override;
+  void StartWatchingEvents() override;
+  void StopWatchingEvents() override;
+  void OnUvRunOnceDone() override;
+
+  void WatchBackendFd();
+
+  // Runs UvRunOnce() unless it is already running further up the stack.
+  void RunUvLoop();
+
+  // base::MessagePumpForUI::FdWatcher
+  void OnFileCanReadWithoutBlocking(int fd) override;
+  void OnFileCanWriteWithoutBlocking(int fd) override {}
 
   // Epoll to poll for uv's backend fd.
   int epoll_;
+
+  // Used instead of |epoll_| when uv's backend fd is watched by the message
+  // pump. The timer fires when the next uv timer is due.
+  std::optional<base::MessagePumpForUI::FdWatchController> fd_controller_;
+  base::OneShotTimer uv_timer_;
+
+  bool fd_watched_ = false;
+  bool in_uv_run_ = false;
 };
 
 }  // namespace electron
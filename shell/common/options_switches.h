@@ -184,6 +184,10 @@ inline constexpr std::string_view kUseSharedTexture = "useSharedTexture";
 inline constexpr std::string_view kNodeIntegrationInSubFrames =
     "nodeIntegrationInSubFrames";
 
+// Share one Node.js environment between same-origin sub frames.
+inline constexpr std::string_view kNodeIntegrationSharedEnvironment =
+    "nodeIntegrationSharedEnvironment";
+
 // Disable window resizing when HTML Fullscreen API is activated.
 inline constexpr std::string_view kDisableHtmlFullscreenWindowResize =
     "disableHtmlFullscreenWindowResize";
@@ -274,6 +278,11 @@ inline constexpr base::cstring_view kScrollBounce = "scroll-bounce";
 inline constexpr base::cstring_view kNodeIntegrationInWorker =
     "node-integration-in-worker";
 
+// Command switch passed to renderer process to control
+// nodeIntegrationSharedEnvironment.
+inline constexpr base::cstring_view kNodeIntegrationSharedEnvironment =
+    "node-integration-shared-environment";
+
 // Widevine options
 // Path to Widevine CDM binaries.
 inline constexpr base::cstring_view kWidevineCdmPath = "widevine-cdm-path";
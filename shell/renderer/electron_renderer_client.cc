@@ -10,6 +10,8 @@
 #include "base/command_line.h"
 #include "base/containers/contains.h"
 #include "base/debug/stack_trace.h"
+#include "base/process/process_handle.h"
+#include "base/process/process_metrics.h"
 #include "content/public/renderer/render_frame.h"
 #include "net/http/http_request_headers.h"
 #include "shell/common/api/electron_bindings.h"
@@ -20,8 +22,10 @@
 #include "shell/common/node_util.h"
 #include "shell/common/options_switches.h"
 #include "shell/renderer/electron_render_frame_observer.h"
+#include "shell/renderer/preload_utils.h"
 #include "shell/renderer/web_worker_observer.h"
 #include "third_party/blink/public/common/web_preferences/web_preferences.h"
+#include "third_party/blink/public/platform/web_security_origin.h"
 #include "third_party/blink/public/web/web_document.h"
 #include "third_party/blink/public/web/web_local_frame.h"
 #include "third_party/blink/renderer/core/execution_context/execution_context.h"  // nogncheck
@@ -40,7 +44,8 @@ ElectronRendererClient::ElectronRendererClient()
     : node_bindings_{NodeBindings::Create(
           NodeBindings::BrowserEnvironment::kRenderer)},
       electron_bindings_{
-          std::make_unique<ElectronBindings>(node_bindings_->uv_loop())} {}
+          std::make_unique<ElectronBindings>(node_bindings_->uv_loop())},
+      metrics_{base::ProcessMetrics::CreateCurrentProcessMetrics()} {}
 
 ElectronRendererClient::~ElectronRendererClient() = default;
 
@@ -68,6 +73,8 @@ void ElectronRendererClient::RunScriptsAtDocumentStart(
     v8::Context::Scope context_scope(env->context());
     gin_helper::EmitEvent(env->isolate(), env->process_object(),
                           "document-start");
+  } else {
+    EmitProcessEvent(render_frame, "document-start");
   }
 }
 
@@ -81,6 +88,8 @@ void ElectronRendererClient::RunScriptsAtDocumentEnd(
     v8::Context::Scope context_scope(env->context());
     gin_helper::EmitEvent(env->isolate(), env->process_object(),
                           "document-end");
+  } else {
+    EmitProcessEvent(render_frame, "document-end");
   }
 }
 
@@ -102,6 +111,11 @@ void ElectronRendererClient::DidCreateScriptContext(
 
   injected_frames_.insert(render_frame);
 
+  node::Environment* shared_env = GetSharedEnvironment(render_frame);
+  if (shared_env &&
+      AttachToSharedEnvironment(renderer_context, render_frame, shared_env))
+    return;
+
   if (!node_integration_initialized_) {
     node_integration_initialized_ = true;
     node_bindings_->Initialize(renderer_context);
@@ -183,6 +197,16 @@ void ElectronRendererClient::WillReleaseScriptContext(
   if (injected_frames_.erase(render_frame) == 0)
     return;
 
+  if (shared_frames_.erase(render_frame)) {
+    auto* isolate = context->GetIsolate();
+    v8::MicrotasksScope microtasks_scope(
+        context, v8::MicrotasksScope::kDoNotRunMicrotasks);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::Scope context_scope(context);
+    preload_utils::InvokeEmitProcessEvent(context, "exit");
+    return;
+  }
+
   node::Environment* env = node::Environment::GetCurrent(context);
   const auto iter = std::ranges::find_if(
       environments_, [env](auto& item) { return env == item.get(); });
@@ -204,6 +228,11 @@ void ElectronRendererClient::WillReleaseScriptContext(
 
   // ElectronBindings is tracking node environments.
   electron_bindings_->EnvironmentDestroyed(env);
+
+  // Frames are detached before the script context of their parent is
+  // released, so no frame should still be sharing the environment.
+  base::EraseIf(shared_frames_,
+                [env](const auto& item) { return item.second == env; });
 }
 
 void ElectronRendererClient::WorkerScriptReadyForEvaluationOnWorkerThread(
@@ -303,4 +332,98 @@ node::Environment* ElectronRendererClient::GetEnvironment(
              : nullptr;
 }
 
+node::Environment* ElectronRendererClient::GetSharedEnvironment(
+    content::RenderFrame* render_frame) const {
+  // This won't be correct for in-process child windows with webPreferences
+  // that have a different value for nodeIntegrationSharedEnvironment.
+  if (!base::CommandLine::ForCurrentProcess()->HasSwitch(
+          switches::kNodeIntegrationSharedEnvironment))
+    return nullptr;
+
+  // Only ancestors are considered, as a frame is always detached before the
+  // script contexts of its ancestors are released.
+  blink::WebLocalFrame* frame = render_frame->GetWebFrame();
+  for (blink::WebFrame* parent = frame->Parent();
+       parent && parent->IsWebLocalFrame(); parent = parent->Parent()) {
+    blink::WebLocalFrame* local_parent = parent->ToWebLocalFrame();
+    if (!local_parent->GetSecurityOrigin().IsSameOriginWith(
+            frame->GetSecurityOrigin()))
+      return nullptr;
+
+    auto* parent_render_frame =
+        content::RenderFrame::FromWebFrame(local_parent);
+    const auto iter = shared_frames_.find(parent_render_frame);
+    if (iter != shared_frames_.end())
+      return iter->second;
+    if (node::Environment* env = GetEnvironment(parent_render_frame))
+      return env;
+  }
+  return nullptr;
+}
+
+bool ElectronRendererClient::AttachToSharedEnvironment(
+    v8::Local<v8::Context> context,
+    content::RenderFrame* render_frame,
+    node::Environment* env) {
+  auto* isolate = context->GetIsolate();
+
+  // Set by renderer/init.ts when the environment was loaded.
+  v8::Local<v8::Value> shared_environment;
+  {
+    v8::Context::Scope context_scope(env->context());
+    gin_helper::Dictionary global(isolate, env->context()->Global());
+    if (!global.GetHidden("shared-environment", &shared_environment))
+      return false;
+  }
+
+  // The frame runs the sandboxed preload bundle, whose preload scripts are
+  // given a require function and a process object backed by |env|.
+  auto binding = gin_helper::Dictionary::CreateEmpty(isolate);
+  binding.SetMethod("get", preload_utils::GetBinding);
+  binding.SetMethod("createPreloadScript", preload_utils::CreatePreloadScript);
+  binding.Set("node", shared_environment);
+
+  auto process = gin_helper::Dictionary::CreateEmpty(isolate);
+  binding.Set("process", process);
+
+  ElectronBindings::BindProcess(isolate, &process, metrics_.get());
+  BindProcess(isolate, &process, render_frame);
+
+  process.SetMethod("uptime", preload_utils::Uptime);
+  process.Set("argv", base::CommandLine::ForCurrentProcess()->argv());
+  process.SetReadOnly("pid", base::GetCurrentProcId());
+  process.SetReadOnly("type", "renderer");
+
+  v8::LocalVector<v8::String> sandbox_preload_bundle_params(
+      isolate, {node::FIXED_ONE_BYTE_STRING(isolate, "binding")});
+
+  v8::LocalVector<v8::Value> sandbox_preload_bundle_args(
+      isolate, {binding.GetHandle()});
+
+  shared_frames_.emplace(render_frame, env);
+  util::CompileAndCall(context, "electron/js2c/sandbox_bundle",
+                       &sandbox_preload_bundle_params,
+                       &sandbox_preload_bundle_args);
+
+  preload_utils::InvokeEmitProcessEvent(context, "loaded");
+  return true;
+}
+
+void ElectronRendererClient::EmitProcessEvent(
+    content::RenderFrame* render_frame,
+    const char* event_name) {
+  if (!shared_frames_.contains(render_frame))
+    return;
+
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context =
+      GetContext(render_frame->GetWebFrame(), isolate);
+  v8::MicrotasksScope microtasks_scope(
+      context, v8::MicrotasksScope::kDoNotRunMicrotasks);
+  v8::Context::Scope context_scope(context);
+
+  preload_utils::InvokeEmitProcessEvent(context, event_name);
+}
+
 }  // namespace electron
@@ -7,9 +7,14 @@
 
 #include <memory>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
 #include "shell/renderer/renderer_client_base.h"
 
+namespace base {
+class ProcessMetrics;
+}
+
 namespace node {
 class Environment;
 }
@@ -51,11 +56,22 @@ class ElectronRendererClient : public RendererClientBase {
 
   node::Environment* GetEnvironment(content::RenderFrame* frame) const;
 
+  // Returns the environment |render_frame| can share with its ancestors when
+  // nodeIntegrationSharedEnvironment is enabled, or nullptr.
+  node::Environment* GetSharedEnvironment(
+      content::RenderFrame* render_frame) const;
+  bool AttachToSharedEnvironment(v8::Local<v8::Context> context,
+                                 content::RenderFrame* render_frame,
+                                 node::Environment* env);
+  void EmitProcessEvent(content::RenderFrame* render_frame,
+                        const char* event_name);
+
   // Whether the node integration has been initialized.
   bool node_integration_initialized_ = false;
 
   const std::unique_ptr<NodeBindings> node_bindings_;
   const std::unique_ptr<ElectronBindings> electron_bindings_;
+  std::unique_ptr<base::ProcessMetrics> metrics_;
 
   // The node::Environment::GetCurrent API does not return nullptr when it
   // is called for a context without node::Environment, so we have to keep
@@ -66,6 +82,10 @@ class ElectronRendererClient : public RendererClientBase {
   // its script context. Doing so in a web page without scripts would trigger
   // assertion, so we have to keep a book of injected web frames.
   base::flat_set<content::RenderFrame*> injected_frames_;
+
+  // Frames that use the environment of one of their ancestors instead of
+  // having their own, see GetSharedEnvironment().
+  base::flat_map<content::RenderFrame*, node::Environment*> shared_frames_;
 };
 
 }  // namespace electron
@@ -4,7 +4,6 @@
 
 #include "shell/renderer/electron_sandboxed_renderer_client.h"
 
-#include <iterator>
 #include <vector>
 
 #include "base/base_paths.h"
@@ -34,29 +33,6 @@ namespace {
 // Data which only lives on the service worker's thread
 constinit thread_local ServiceWorkerData* service_worker_data = nullptr;
 
-constexpr std::string_view kEmitProcessEventKey = "emit-process-event";
-
-void InvokeEmitProcessEvent(v8::Local<v8::Context> context,
-                            const std::string& event_name) {
-  auto* isolate = context->GetIsolate();
-  // set by sandboxed_renderer/init.js
-  auto binding_key = gin::ConvertToV8(isolate, kEmitProcessEventKey)
-                         ->ToString(context)
-                         .ToLocalChecked();
-  auto private_binding_key = v8::Private::ForApi(isolate, binding_key);
-  auto global_object = context->Global();
-  v8::Local<v8::Value> callback_value;
-  if (!global_object->GetPrivate(context, private_binding_key)
-           .ToLocal(&callback_value))
-    return;
-  if (callback_value.IsEmpty() || !callback_value->IsFunction())
-    return;
-  auto callback = callback_value.As<v8::Function>();
-  v8::Local<v8::Value> args[] = {gin::ConvertToV8(isolate, event_name)};
-  std::ignore =
-      callback->Call(context, callback, std::size(args), std::data(args));
-}
-
 }  // namespace
 
 ElectronSandboxedRendererClient::ElectronSandboxedRendererClient() {
@@ -135,7 +111,7 @@ void ElectronSandboxedRendererClient::DidCreateScriptContext(
 
   v8::HandleScope handle_scope(isolate);
   v8::Context::Scope context_scope(context);
-  InvokeEmitProcessEvent(context, "loaded");
+  preload_utils::InvokeEmitProcessEvent(context, "loaded");
 }
 
 void ElectronSandboxedRendererClient::WillReleaseScriptContext(
@@ -149,7 +125,7 @@ void ElectronSandboxedRendererClient::WillReleaseScriptContext(
       context, v8::MicrotasksScope::kDoNotRunMicrotasks);
   v8::HandleScope handle_scope(isolate);
   v8::Context::Scope context_scope(context);
-  InvokeEmitProcessEvent(context, "exit");
+  preload_utils::InvokeEmitProcessEvent(context, "exit");
 }
 
 void ElectronSandboxedRendererClient::EmitProcessEvent(
@@ -167,7 +143,7 @@ void ElectronSandboxedRendererClient::EmitProcessEvent(
       context, v8::MicrotasksScope::kDoNotRunMicrotasks);
   v8::Context::Scope context_scope(context);
 
-  InvokeEmitProcessEvent(context, event_name);
+  preload_utils::InvokeEmitProcessEvent(context, event_name);
 }
 
 void ElectronSandboxedRendererClient::WillEvaluateServiceWorkerOnWorkerThread(
@@ -4,12 +4,25 @@
 
 #include "shell/renderer/preload_utils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "base/compiler_specific.h"
+#include "base/containers/span.h"
 #include "base/process/process.h"
 #include "base/strings/strcat.h"
+#include "base/trace_event/trace_event.h"
 #include "shell/common/gin_helper/arguments.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/v8_util.h"
 #include "v8/include/v8-context.h"
+#include "v8/include/v8-script.h"
 
 namespace electron::preload_utils {
 
@@ -17,6 +30,13 @@ namespace {
 
 constexpr std::string_view kBindingCacheKey = "native-binding-cache";
 
+constexpr std::string_view kEmitProcessEventKey = "emit-process-event";
+
+// Code cache outcomes of this renderer, reported as trace counters. Preload
+// realms of service workers compile on their own threads.
+std::atomic<uint64_t> g_code_cache_hits = 0;
+std::atomic<uint64_t> g_code_cache_rejects = 0;
+
 v8::Local<v8::Object> GetBindingCache(v8::Isolate* isolate) {
   auto context = isolate->GetCurrentContext();
   gin_helper::Dictionary global(isolate, context->Global());
@@ -60,14 +80,87 @@ v8::Local<v8::Value> GetBinding(v8::Isolate* isolate,
   return exports;
 }
 
-v8::Local<v8::Value> CreatePreloadScript(v8::Isolate* isolate,
-                                         v8::Local<v8::String> source) {
+v8::Local<v8::Value> CreatePreloadScript(
+    v8::Isolate* isolate,
+    v8::Local<v8::String> source,
+    std::optional<v8::Local<v8::Value>> code_cache,
+    std::optional<bool> produce_code_cache) {
   auto context = isolate->GetCurrentContext();
-  auto maybe_script = v8::Script::Compile(context, source);
+
+  // The cache is copied as V8 may still use it once the script compiled.
+  std::vector<uint8_t> cache_bytes;
+  v8::ScriptCompiler::CachedData* cached_data = nullptr;
+  auto options = v8::ScriptCompiler::kNoCompileOptions;
+  if (code_cache && (*code_cache)->IsArrayBufferView()) {
+    const auto bytes =
+        util::as_byte_span(code_cache->As<v8::ArrayBufferView>());
+    cache_bytes.assign(bytes.begin(), bytes.end());
+    cached_data = new v8::ScriptCompiler::CachedData(
+        cache_bytes.data(), static_cast<int>(cache_bytes.size()));
+    options = v8::ScriptCompiler::kConsumeCodeCache;
+  }
+
+  // |script_source| takes ownership of |cached_data|.
+  v8::ScriptCompiler::Source script_source(source, cached_data);
   v8::Local<v8::Script> script;
-  if (!maybe_script.ToLocal(&script))
+  if (!v8::ScriptCompiler::Compile(context, &script_source, options)
+           .ToLocal(&script))
+    return {};
+
+  const bool rejected = cached_data && cached_data->rejected;
+  if (cached_data && !rejected) {
+    TRACE_COUNTER1("electron", "PreloadCodeCache::Hits",
+                   g_code_cache_hits.fetch_add(1) + 1);
+  } else if (rejected) {
+    TRACE_COUNTER1("electron", "PreloadCodeCache::Rejects",
+                   g_code_cache_rejects.fetch_add(1) + 1);
+  }
+
+  v8::Local<v8::Value> preload;
+  if (!script->Run(context).ToLocal(&preload))
     return {};
-  return script->Run(context).ToLocalChecked();
+
+  auto result = gin_helper::Dictionary::CreateEmpty(isolate);
+  result.Set("preload", preload);
+
+  // Produce a cache for the next frames when there was none or V8 could not
+  // use it. The preload is wrapped in a parenthesized function, which V8
+  // compiles eagerly, so the cache covers its top level code.
+  if (produce_code_cache.value_or(false) && (!cached_data || rejected)) {
+    std::unique_ptr<v8::ScriptCompiler::CachedData> new_cache(
+        v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    if (new_cache && new_cache->length > 0) {
+      const auto new_bytes = UNSAFE_BUFFERS(base::span(
+          new_cache->data, static_cast<size_t>(new_cache->length)));
+      auto array = v8::Uint8Array::New(
+          v8::ArrayBuffer::New(isolate, new_bytes.size()), 0, new_bytes.size());
+      std::ranges::copy(new_bytes, util::as_byte_span(array).begin());
+      result.Set("codeCache", array);
+    }
+  }
+
+  return result.GetHandle();
+}
+
+void InvokeEmitProcessEvent(v8::Local<v8::Context> context,
+                            const std::string& event_name) {
+  auto* isolate = context->GetIsolate();
+  // set by sandboxed_renderer/init.js
+  auto binding_key = gin::ConvertToV8(isolate, kEmitProcessEventKey)
+                         ->ToString(context)
+                         .ToLocalChecked();
+  auto private_binding_key = v8::Private::ForApi(isolate, binding_key);
+  auto global_object = context->Global();
+  v8::Local<v8::Value> callback_value;
+  if (!global_object->GetPrivate(context, private_binding_key)
+           .ToLocal(&callback_value))
+    return;
+  if (callback_value.IsEmpty() || !callback_value->IsFunction())
+    return;
+  auto callback = callback_value.As<v8::Function>();
+  v8::Local<v8::Value> args[] = {gin::ConvertToV8(isolate, event_name)};
+  std::ignore =
+      callback->Call(context, callback, std::size(args), std::data(args));
 }
 
 double Uptime() {
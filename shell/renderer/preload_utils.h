@@ -5,6 +5,9 @@
 #ifndef ELECTRON_SHELL_RENDERER_PRELOAD_UTILS_H_
 #define ELECTRON_SHELL_RENDERER_PRELOAD_UTILS_H_
 
+#include <optional>
+#include <string>
+
 #include "v8/include/v8-forward.h"
 
 namespace gin_helper {
@@ -17,8 +20,19 @@ v8::Local<v8::Value> GetBinding(v8::Isolate* isolate,
                                 v8::Local<v8::String> key,
                                 gin_helper::Arguments* margs);
 
-v8::Local<v8::Value> CreatePreloadScript(v8::Isolate* isolate,
-                                         v8::Local<v8::String> source);
+// Compiles and runs |source|, consuming |code_cache| when given. Returns an
+// object with the result as |preload|, and, if |produce_code_cache| is set, a
+// new |codeCache| when none was given or it was rejected.
+v8::Local<v8::Value> CreatePreloadScript(
+    v8::Isolate* isolate,
+    v8::Local<v8::String> source,
+    std::optional<v8::Local<v8::Value>> code_cache,
+    std::optional<bool> produce_code_cache);
+
+// Emits |event_name| on the process objects of a context that was set up by
+// the sandboxed renderer bundle.
+void InvokeEmitProcessEvent(v8::Local<v8::Context> context,
+                            const std::string& event_name);
 
 double Uptime();
 
@@ -48,6 +48,11 @@ void V8FatalErrorCallback(const char* location, const char* message) {
   *zero = 0;
 }
 
+void NotifyReady() {
+  if (g_client_remote.is_bound() && g_client_remote.is_connected())
+    g_client_remote->OnReady();
+}
+
 URLLoaderBundle::URLLoaderBundle() = default;
 
 URLLoaderBundle::~URLLoaderBundle() = default;
@@ -167,6 +172,7 @@ void NodeService::Initialize(
   gin_helper::Dictionary process(node_env_->isolate(),
                                  node_env_->process_object());
   process.SetHidden("_serviceStartupScript", params->script);
+  process.SetHidden("_serviceStartupPreload", params->preload);
 
   // Setup microtask runner.
   js_env_->CreateMicrotasksRunner();
@@ -28,6 +28,10 @@ class ElectronBindings;
 class JavascriptEnvironment;
 class NodeBindings;
 
+// Tells the browser process that the preload modules and the entry script
+// are loaded.
+void NotifyReady();
+
 class URLLoaderBundle {
  public:
   URLLoaderBundle();
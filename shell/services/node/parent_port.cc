@@ -16,6 +16,7 @@
 #include "shell/common/gin_helper/event_emitter_caller.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/v8_util.h"
+#include "shell/services/node/node_service.h"
 #include "third_party/blink/public/common/messaging/transferable_message_mojom_traits.h"
 
 namespace electron {
@@ -134,6 +135,7 @@ void Initialize(v8::Local<v8::Object> exports,
   v8::Isolate* isolate = context->GetIsolate();
   gin_helper::Dictionary dict(isolate, exports);
   dict.SetMethod("createParentPort", &electron::ParentPort::Create);
+  dict.SetMethod("notifyReady", &electron::NotifyReady);
 }
 
 }  // namespace
@@ -1168,6 +1168,24 @@ describe('app module', () => {
     });
   });
 
+  describe('startupCodeCache', () => {
+    const appPath = path.join(__dirname, 'fixtures', 'apps', 'startup-code-cache');
+    const appName = JSON.parse(fs.readFileSync(path.join(appPath, 'package.json'), 'utf8')).name;
+    const cacheRoot = path.join(app.getPath('appData'), appName, 'Startup Code Cache');
+
+    beforeEach(() => {
+      fs.rmSync(path.join(app.getPath('appData'), appName), { force: true, recursive: true });
+    });
+
+    it('records the modules compiled during startup', () => {
+      const { status, stdout } = cp.spawnSync(process.execPath, [appPath]);
+      expect(status).to.equal(0);
+      expect(stdout.toString().trim()).to.equal('hello');
+      expect(fs.readdirSync(cacheRoot)).to.deep.equal(['1.2.3']);
+      expect(fs.readdirSync(path.join(cacheRoot, '1.2.3'))).to.not.be.empty();
+    });
+  });
+
   describe('setAppLogsPath(path)', () => {
     it('throws when a relative path is passed', () => {
       const badPath = 'hey/hi/hello';
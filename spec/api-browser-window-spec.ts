@@ -3688,6 +3688,43 @@ describe('BrowserWindow module', () => {
         expect(test).to.equal('preload');
       });
 
+      it('runs the preload script in every new window', async () => {
+        for (let i = 0; i < 3; i++) {
+          const w = new BrowserWindow({
+            show: false,
+            webPreferences: {
+              sandbox: true,
+              preload,
+              contextIsolation: false
+            }
+          });
+          w.loadFile(path.join(fixtures, 'api', 'preload.html'));
+          const [, test] = await once(ipcMain, 'answer');
+          expect(test).to.equal('preload');
+        }
+      });
+
+      it('picks up changes to the preload script', async () => {
+        const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-preload-'));
+        defer(() => fs.rmSync(dir, { recursive: true, force: true }));
+        const changingPreload = path.join(dir, 'preload.js');
+        const loadWithPreload = async (answer: string) => {
+          fs.writeFileSync(changingPreload, `require('electron').ipcRenderer.send('answer', ${JSON.stringify(answer)});`);
+          const w = new BrowserWindow({
+            show: false,
+            webPreferences: {
+              sandbox: true,
+              preload: changingPreload
+            }
+          });
+          w.loadURL('about:blank');
+          const [, test] = await once(ipcMain, 'answer');
+          return test;
+        };
+        expect(await loadWithPreload('before')).to.equal('before');
+        expect(await loadWithPreload('after the change')).to.equal('after the change');
+      });
+
       it('exposes "loaded" event to preload script', async () => {
         const w = new BrowserWindow({
           show: false,
@@ -4656,6 +4693,91 @@ describe('BrowserWindow module', () => {
     });
   });
 
+  describe('beginFrameEncoding method', () => {
+    afterEach(closeAllWindows);
+
+    it('emits encoded chunks starting with a keyframe', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixtures, 'api', 'frame-subscriber.html'));
+      const chunk = await new Promise<any>((resolve) => {
+        w.webContents.beginFrameEncoding({ codec: 'vp8' }, resolve);
+      });
+      await w.webContents.endFrameEncoding();
+      expect(chunk.data).to.be.an.instanceOf(Buffer);
+      expect(chunk.data.length).to.be.greaterThan(0);
+      expect(chunk.keyFrame).to.be.true('first chunk is not a keyframe');
+    });
+
+    it('writes an IVF file when a path is given', async () => {
+      const w = new BrowserWindow({ show: false });
+      const outputPath = path.join(os.tmpdir(), `frame-encoding-${Date.now()}.ivf`);
+      await w.loadFile(path.join(fixtures, 'api', 'frame-subscriber.html'));
+      w.webContents.beginFrameEncoding({ path: outputPath, keyframeInterval: 10 });
+      await setTimeout(500);
+      await w.webContents.endFrameEncoding();
+      try {
+        const header = fs.readFileSync(outputPath).subarray(0, 8);
+        expect(header.subarray(0, 4).toString()).to.equal('DKIF');
+      } finally {
+        fs.rmSync(outputPath, { force: true });
+      }
+    });
+
+    // Returns the frame count of the IVF header and the number of frames
+    // actually in the file.
+    const countIvfFrames = (file: Buffer) => {
+      let frames = 0;
+      for (let offset = 32; offset + 12 <= file.length; frames++) {
+        offset += 12 + file.readUInt32LE(offset);
+      }
+      return { header: file.readUInt32LE(24), frames };
+    };
+
+    it('keeps the size of the first frame when the window is resized', async () => {
+      const w = new BrowserWindow({ show: false, width: 400, height: 300 });
+      const outputPath = path.join(os.tmpdir(), `frame-encoding-${Date.now()}.ivf`);
+      defer(() => fs.rmSync(outputPath, { force: true }));
+      await w.loadFile(path.join(fixtures, 'api', 'frame-subscriber.html'));
+      w.webContents.beginFrameEncoding({ path: outputPath });
+      await setTimeout(300);
+      w.setSize(500, 400);
+      await setTimeout(300);
+      await w.webContents.endFrameEncoding();
+      const file = fs.readFileSync(outputPath);
+      const { header, frames } = countIvfFrames(file);
+      expect(header).to.equal(frames);
+      expect(frames).to.be.greaterThan(0);
+    });
+
+    it('finalizes the file when the WebContents is destroyed', async () => {
+      const w = new BrowserWindow({ show: false });
+      const outputPath = path.join(os.tmpdir(), `frame-encoding-${Date.now()}.ivf`);
+      defer(() => fs.rmSync(outputPath, { force: true }));
+      await w.loadFile(path.join(fixtures, 'api', 'frame-subscriber.html'));
+      w.webContents.beginFrameEncoding({ path: outputPath });
+      await setTimeout(500);
+      w.destroy();
+      await waitUntil(() => {
+        const { header, frames } = countIvfFrames(fs.readFileSync(outputPath));
+        return header > 0 && header === frames;
+      });
+    });
+
+    it('throws for relative paths', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => {
+        w.webContents.beginFrameEncoding({ path: 'frames.ivf' });
+      }).to.throw("'path' must be an absolute path");
+    });
+
+    it('throws for unknown codecs', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => {
+        w.webContents.beginFrameEncoding({ codec: 'mpeg2' as any }, () => {});
+      }).to.throw('Unknown codec: mpeg2');
+    });
+  });
+
   describe('savePage method', () => {
     const savePageDir = path.join(fixtures, 'save_page');
     const savePageHtmlPath = path.join(savePageDir, 'save_page.html');
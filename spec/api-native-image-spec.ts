@@ -387,6 +387,118 @@ describe('nativeImage module', () => {
       expect(good.toPNG()).to.have.lengthOf.at.most(better.toPNG().length);
       expect(better.toPNG()).to.have.lengthOf.below(best.toPNG().length);
     });
+
+    it('supports a filter option', () => {
+      const image = nativeImage.createFromPath(path.join(fixturesPath, 'assets', 'logo.png'));
+      for (const filter of ['nearest', 'bilinear', 'lanczos3'] as const) {
+        expect(image.resize({ width: 269, filter }).getSize()).to.deep.equal({ width: 269, height: 95 });
+      }
+    });
+
+    it('applies the filter to every scale factor', () => {
+      const image = nativeImage.createFromPath(path.join(fixturesPath, 'assets', 'logo.png'));
+      image.addRepresentation({ scaleFactor: 2.0, buffer: image.resize({ width: 1076 }).toPNG() });
+      // The 2x representation of a resized image is only produced on demand.
+      const resized = image.resize({ width: 538 }).resize({ width: 269, filter: 'bilinear' });
+      expect(resized.toBitmap({ scaleFactor: 2.0 })).to.have.lengthOf(538 * 190 * 4);
+    });
+
+    it('throws for an unknown filter', () => {
+      const image = nativeImage.createFromPath(path.join(fixturesPath, 'assets', 'logo.png'));
+      expect(() => image.resize({ width: 100, filter: 'cubic' as any })).to.throw(TypeError, /must be one of nearest, bilinear or lanczos3/);
+      expect(() => image.resizeAsync({ width: 100, filter: 'cubic' as any })).to.throw(TypeError, /Invalid filter 'cubic'/);
+    });
+  });
+
+  describe('resizeInto(buffer, options)', () => {
+    it('writes the resized bitmap into the buffer', () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const buffer = Buffer.alloc(269 * 95 * 4);
+      for (const filter of ['nearest', 'bilinear', 'lanczos3'] as const) {
+        buffer.fill(0);
+        expect(image.resizeInto(buffer, { width: 269, filter })).to.deep.equal({ width: 269, height: 95 });
+        expect(buffer.some(byte => byte !== 0)).to.be.true();
+      }
+    });
+
+    it('matches resize() with the same filter', () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const buffer = Buffer.alloc(100 * 100 * 4);
+      image.resizeInto(buffer, { width: 100, height: 100, filter: 'bilinear' });
+      const expected = image.resize({ width: 100, height: 100, filter: 'bilinear' }).toBitmap();
+      expect(buffer.equals(expected)).to.be.true();
+    });
+
+    it('throws when the buffer is too small', () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      expect(() => image.resizeInto(Buffer.alloc(16), { width: 100 })).to.throw(/buffer must be at least/);
+    });
+
+    it('throws for an unknown filter', () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      expect(() => image.resizeInto(Buffer.alloc(100 * 100 * 4), { width: 100, filter: 'cubic' as any })).to.throw(TypeError, /Invalid filter 'cubic'/);
+    });
+
+    it('returns an empty size for an empty image', () => {
+      const size = nativeImage.createEmpty().resizeInto(Buffer.alloc(16), { width: 1, height: 1 });
+      expect(size).to.deep.equal({ width: 0, height: 0 });
+    });
+  });
+
+  describe('async variants', () => {
+    it('toPNGAsync() matches toPNG()', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const buffer = await image.toPNGAsync({ scaleFactor: 2.0 });
+      expect(buffer.equals(image.toPNG({ scaleFactor: 2.0 }))).to.be.true();
+    });
+
+    it('toJPEGAsync() returns an encoded JPEG', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const buffer = await image.toJPEGAsync(80);
+      expect(nativeImage.createFromBuffer(buffer).getSize()).to.deep.equal(image.getSize());
+    });
+
+    it('toDataURLAsync() matches toDataURL()', async () => {
+      const image = nativeImage.createFromDataURL(image3x3.dataUrl);
+      expect(await image.toDataURLAsync()).to.equal(image.toDataURL());
+    });
+
+    it('createFromPathAsync() loads images', async () => {
+      const image = await nativeImage.createFromPathAsync(imageLogo.path);
+      expect(image.getSize()).to.deep.equal({ width: imageLogo.width, height: imageLogo.height });
+      expect((await nativeImage.createFromPathAsync('does-not-exist.png')).isEmpty()).to.be.true();
+    });
+
+    it('createFromBufferAsync() decodes buffers', async () => {
+      const source = nativeImage.createFromPath(imageLogo.path);
+      const image = await nativeImage.createFromBufferAsync(source.toPNG(), { scaleFactor: 2.0 });
+      expect(image.getSize()).to.deep.equal({ width: imageLogo.width / 2, height: imageLogo.height / 2 });
+    });
+
+    it('createFromBufferAsync() is not affected by later writes to the buffer', async () => {
+      const source = nativeImage.createFromPath(imageLogo.path);
+      const png = source.toPNG();
+      const promise = nativeImage.createFromBufferAsync(png);
+      png.fill(0);
+      const image = await promise;
+      expect(image.getSize()).to.deep.equal({ width: imageLogo.width, height: imageLogo.height });
+    });
+
+    it('resizeAsync() resizes every representation', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      image.addRepresentation({ scaleFactor: 2.0, buffer: image.resize({ width: 1076 }).toPNG() });
+      const resized = await image.resizeAsync({ width: 269 });
+      expect(resized.getSize()).to.deep.equal({ width: 269, height: 95 });
+      expect(resized.getSize(2.0)).to.deep.equal({ width: 269, height: 95 });
+      expect(resized.getScaleFactors()).to.deep.equal([1, 2]);
+    });
+
+    it('settles many concurrent calls', async () => {
+      const image = nativeImage.createFromPath(imageLogo.path);
+      const buffers = await Promise.all(Array.from({ length: 32 }, () => image.toJPEGAsync(50)));
+      expect(buffers).to.have.lengthOf(32);
+      for (const buffer of buffers) expect(buffer.length).to.be.greaterThan(0);
+    });
   });
 
   describe('crop(bounds)', () => {
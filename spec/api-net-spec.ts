@@ -2,10 +2,12 @@ import { net, session, ClientRequest, ClientRequestConstructorOptions, utilityPr
 
 import { expect } from 'chai';
 
+import * as crypto from 'node:crypto';
 import { once } from 'node:events';
 import * as fs from 'node:fs';
 import * as http from 'node:http';
 import * as http2 from 'node:http2';
+import * as os from 'node:os';
 import * as path from 'node:path';
 import { setTimeout } from 'node:timers/promises';
 
@@ -232,6 +234,42 @@ describe('net module', () => {
         expect(chunkIndex).to.be.equal(chunkCount);
       });
 
+      test('should emit response chunks that each own their memory', async () => {
+        const bodyData = randomBuffer(4 * kOneMegaByte);
+        const serverUrl = await respondOnce.toSingleURL((request, response) => {
+          response.end(bodyData);
+        });
+        const urlRequest = net.request(serverUrl);
+        const response = await getResponse(urlRequest);
+        const chunks: Buffer[] = [];
+        response.on('data', (chunk: Buffer) => chunks.push(chunk));
+        await new Promise<void>((resolve) => response.on('end', resolve));
+        expect(Buffer.concat(chunks).equals(bodyData)).to.be.true();
+        // A retained chunk must not keep more than its own bytes alive.
+        for (const chunk of chunks) expect(chunk.buffer.byteLength).to.equal(chunk.byteLength);
+      });
+
+      test('should upload chunks without them being modified', async () => {
+        const serverUrl = await respondOnce.toSingleURL(async (request, response) => {
+          response.end(await collectStreamBodyBuffer(request));
+        });
+        const urlRequest = net.request({
+          method: 'POST',
+          url: serverUrl
+        });
+        urlRequest.chunkedEncoding = true;
+        const sent = randomBuffer(kOneMegaByte);
+        // Write views into a larger buffer to make sure only the viewed range
+        // is uploaded.
+        const backing = Buffer.concat([randomBuffer(kOneKiloByte), sent, randomBuffer(kOneKiloByte)]);
+        for (let offset = 0; offset < sent.length; offset += 64 * kOneKiloByte) {
+          urlRequest.write(backing.subarray(kOneKiloByte + offset, kOneKiloByte + offset + 64 * kOneKiloByte));
+        }
+        const response = await getResponse(urlRequest);
+        const received = await collectStreamBodyBuffer(response);
+        expect(received.equals(sent)).to.be.true();
+      });
+
       for (const extraOptions of [{}, { credentials: 'include' }, { useSessionCookies: false, credentials: 'include' }] as ClientRequestConstructorOptions[]) {
         describe(`authentication when ${JSON.stringify(extraOptions)}`, () => {
           test('should emit the login event when 401', async () => {
@@ -1607,6 +1645,15 @@ describe('net module', () => {
           expect(r.status).to.equal(200);
           await expect(r.text()).to.be.rejectedWith(/ERR_INCOMPLETE_CHUNKED_ENCODING/);
         });
+
+        test('should read large bodies', async () => {
+          const bodyData = randomBuffer(4 * kOneMegaByte);
+          const serverUrl = await respondOnce.toSingleURL((request, response) => {
+            response.end(bodyData);
+          });
+          const r = await net.fetch(serverUrl);
+          expect(Buffer.from(await r.arrayBuffer()).equals(bodyData)).to.be.true();
+        });
       });
     });
 
@@ -1687,5 +1734,144 @@ describe('net module', () => {
         }
       }
     });
+
+    describe('saveToFile', () => {
+      let tmpDir: string;
+      beforeEach(() => {
+        tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-net-spec-'));
+      });
+      afterEach(() => {
+        fs.rmSync(tmpDir, { recursive: true, force: true });
+      });
+
+      const sha256 = (data: Buffer) => crypto.createHash('sha256').update(data).digest('hex');
+
+      // Serves |bodyData|, honoring a "bytes=N-" range unless |ignoreRange|.
+      const serveBody = (bodyData: Buffer, ignoreRange = false) => respondOnce.toSingleURL((request, response) => {
+        const range = /^bytes=(\d+)-$/.exec(request.headers.range ?? '');
+        if (range && !ignoreRange) {
+          const start = Number(range[1]);
+          response.writeHead(206, {
+            'Content-Range': `bytes ${start}-${bodyData.length - 1}/${bodyData.length}`
+          });
+          response.end(bodyData.subarray(start));
+        } else {
+          response.end(bodyData);
+        }
+      });
+
+      test('writes the response body to the file', async () => {
+        const bodyData = randomBuffer(2 * kOneMegaByte);
+        const serverUrl = await serveBody(bodyData);
+        const filePath = path.join(tmpDir, 'download');
+        const urlRequest = net.request({
+          url: serverUrl,
+          saveToFile: { path: filePath, hash: 'sha256' }
+        });
+        let progress = 0;
+        const saved = once(urlRequest, 'saved').then((args) => {
+          // The final progress is emitted before the file is reported saved.
+          expect(progress).to.equal(bodyData.length);
+          return args;
+        });
+        const response = await getResponse(urlRequest);
+        let received = 0;
+        response.on('data', (chunk: Buffer) => { received += chunk.length; });
+        response.on('download-progress', (current: number) => { progress = current; });
+        await once(response, 'end');
+        const [details] = await saved;
+        expect(received).to.equal(0);
+        expect(details.path).to.equal(filePath);
+        expect(details.size).to.equal(bodyData.length);
+        expect(details.hash).to.equal(sha256(bodyData));
+        expect(fs.readFileSync(filePath).equals(bodyData)).to.be.true();
+      });
+
+      test('resumes a partial download', async () => {
+        const bodyData = randomBuffer(kOneMegaByte);
+        const serverUrl = await serveBody(bodyData);
+        const filePath = path.join(tmpDir, 'download');
+        const resumeFrom = 300 * kOneKiloByte;
+        // Anything past |resumeFrom| is discarded.
+        fs.writeFileSync(filePath, Buffer.concat([bodyData.subarray(0, resumeFrom), randomBuffer(kOneKiloByte)]));
+        const urlRequest = net.request({
+          url: serverUrl,
+          saveToFile: { path: filePath, hash: 'sha256', resumeFrom }
+        });
+        const saved = once(urlRequest, 'saved');
+        const response = await getResponse(urlRequest);
+        expect(response.statusCode).to.equal(206);
+        response.resume();
+        const [details] = await saved;
+        expect(details.size).to.equal(bodyData.length);
+        expect(details.hash).to.equal(sha256(bodyData));
+        expect(fs.readFileSync(filePath).equals(bodyData)).to.be.true();
+      });
+
+      test('overwrites the file when the server ignores the range', async () => {
+        const bodyData = randomBuffer(kOneMegaByte);
+        const serverUrl = await serveBody(bodyData, true);
+        const filePath = path.join(tmpDir, 'download');
+        fs.writeFileSync(filePath, randomBuffer(kOneMegaByte));
+        const urlRequest = net.request({
+          url: serverUrl,
+          saveToFile: { path: filePath, resumeFrom: kOneKiloByte }
+        });
+        const saved = once(urlRequest, 'saved');
+        const response = await getResponse(urlRequest);
+        expect(response.statusCode).to.equal(200);
+        response.resume();
+        const [details] = await saved;
+        expect(details.hash).to.be.undefined();
+        expect(fs.readFileSync(filePath).equals(bodyData)).to.be.true();
+      });
+
+      test('fails when resuming past the end of the file', async () => {
+        const serverUrl = await serveBody(randomBuffer(kOneMegaByte));
+        const filePath = path.join(tmpDir, 'download');
+        fs.writeFileSync(filePath, randomBuffer(kOneKiloByte));
+        const urlRequest = net.request({
+          url: serverUrl,
+          saveToFile: { path: filePath, resumeFrom: 2 * kOneKiloByte }
+        });
+        urlRequest.on('response', (response) => response.on('error', () => {}));
+        urlRequest.end();
+        const [error] = await once(urlRequest, 'error');
+        expect(error.message).to.equal('net::ERR_INVALID_ARGUMENT');
+      });
+
+      test('leaves the file alone for error responses', async () => {
+        const serverUrl = await respondOnce.toSingleURL((request, response) => {
+          response.statusCode = 404;
+          response.end('not found');
+        });
+        const filePath = path.join(tmpDir, 'download');
+        const original = randomBuffer(kOneKiloByte);
+        fs.writeFileSync(filePath, original);
+        const urlRequest = net.request({
+          url: serverUrl,
+          saveToFile: { path: filePath }
+        });
+        const response = await getResponse(urlRequest);
+        expect(response.statusCode).to.equal(404);
+        expect(await collectStreamBody(response)).to.equal('not found');
+        expect(fs.readFileSync(filePath).equals(original)).to.be.true();
+      });
+
+      test('rejects invalid options', () => {
+        expect(() => net.request({
+          url: 'http://127.0.0.1',
+          saveToFile: { path: '' }
+        })).to.throw(/saveToFile.path must be an absolute path/);
+        expect(() => net.request({
+          url: 'http://127.0.0.1',
+          saveToFile: { path: 'relative/download' }
+        })).to.throw(/saveToFile.path must be an absolute path/);
+        expect(() => net.request({
+          url: 'http://127.0.0.1',
+          saveToFile: { path: path.join(tmpDir, 'download'), hash: 'md5' }
+        })).to.throw(/Unsupported saveToFile.hash: md5/);
+      });
+    });
   }
 });
@@ -4,9 +4,11 @@ import { expect } from 'chai';
 import { v4 } from 'uuid';
 
 import * as ChildProcess from 'node:child_process';
+import * as crypto from 'node:crypto';
 import { EventEmitter, once } from 'node:events';
 import * as fs from 'node:fs';
 import * as http from 'node:http';
+import * as os from 'node:os';
 import * as path from 'node:path';
 import * as qs from 'node:querystring';
 import * as stream from 'node:stream';
@@ -222,6 +224,21 @@ describe('protocol module', () => {
         expect(r.data).to.equal(text);
       });
 
+      it('sends a large Buffer as response', async () => {
+        const large = Buffer.alloc(32 * 1024 * 1024);
+        for (let i = 0; i < large.length; i += 4096) large[i] = i % 251;
+        registerBufferProtocol(protocolName, (request, callback) => callback(large));
+        const body = Buffer.from(await (await net.fetch(protocolName + '://fake-host')).arrayBuffer());
+        expect(body.equals(large)).to.be.true();
+      });
+
+      it('sends only the bytes of a view into a larger buffer', async () => {
+        const view = Buffer.from('xx' + text + 'yy').subarray(2, 2 + text.length);
+        registerBufferProtocol(protocolName, (request, callback) => callback(view));
+        const body = await (await net.fetch(protocolName + '://fake-host')).text();
+        expect(body).to.equal(text);
+      });
+
       if (name !== 'protocol.registerProtocol') {
         it('fails when sending string', async () => {
           registerBufferProtocol(protocolName, (request, callback) => callback(text as any));
@@ -1122,6 +1139,106 @@ describe('protocol module', () => {
     });
   });
 
+  describe('protocol.registerDirectoryHandler', () => {
+    let rootDir: string;
+    before(() => {
+      rootDir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-directory-handler-'));
+      fs.mkdirSync(path.join(rootDir, 'sub'));
+      fs.writeFileSync(path.join(rootDir, 'index.html'), '<h1>index</h1>');
+      fs.writeFileSync(path.join(rootDir, 'sub', 'index.html'), '<h1>sub</h1>');
+      fs.writeFileSync(path.join(rootDir, 'file.txt'), 'hello world');
+      fs.writeFileSync(path.join(rootDir, 'module.custom'), '{}');
+    });
+    after(() => {
+      fs.rmSync(rootDir, { recursive: true, force: true });
+    });
+    afterEach(() => {
+      try { protocol.unhandle('foo'); } catch { /* ignore */ }
+    });
+
+    it('serves files from the directory', async () => {
+      protocol.registerDirectoryHandler('foo', rootDir);
+      const resp = await net.fetch('foo://app/file.txt');
+      expect(resp.status).to.equal(200);
+      expect(resp.headers.get('content-type')).to.match(/^text\/plain/);
+      expect(await resp.text()).to.equal('hello world');
+      expect(protocol.isProtocolHandled('foo')).to.be.true();
+    });
+
+    it('serves index.html for directories', async () => {
+      protocol.registerDirectoryHandler('foo', rootDir);
+      expect(await (await net.fetch('foo://app/')).text()).to.equal('<h1>index</h1>');
+      expect(await (await net.fetch('foo://app/sub')).text()).to.equal('<h1>sub</h1>');
+    });
+
+    it('fails for missing files and paths outside of the directory', async () => {
+      protocol.registerDirectoryHandler('foo', rootDir);
+      await expect(net.fetch('foo://app/missing.txt')).to.eventually.be.rejectedWith(/ERR_FILE_NOT_FOUND/);
+      await expect(net.fetch('foo://app/%2e%2e%2fsecret.txt')).to.eventually.be.rejectedWith(/ERR_ACCESS_DENIED/);
+    });
+
+    ifit(process.platform === 'win32')('fails for drive letters and alternate data streams', async () => {
+      protocol.registerDirectoryHandler('foo', rootDir);
+      await expect(net.fetch('foo://app/C:%5cWindows%5cwin.ini')).to.eventually.be.rejectedWith(/ERR_ACCESS_DENIED/);
+      await expect(net.fetch('foo://app/C:/Windows/win.ini')).to.eventually.be.rejectedWith(/ERR_ACCESS_DENIED/);
+      await expect(net.fetch('foo://app/file.txt:stream')).to.eventually.be.rejectedWith(/ERR_ACCESS_DENIED/);
+    });
+
+    it('serves the SPA fallback for missing paths without an extension', async () => {
+      protocol.registerDirectoryHandler('foo', rootDir, { spaFallback: 'index.html' });
+      expect(await (await net.fetch('foo://app/some/route')).text()).to.equal('<h1>index</h1>');
+      await expect(net.fetch('foo://app/missing.txt')).to.eventually.be.rejectedWith(/ERR_FILE_NOT_FOUND/);
+    });
+
+    it('adds the configured headers and MIME types', async () => {
+      protocol.registerDirectoryHandler('foo', rootDir, {
+        headers: { 'x-custom': 'yes' },
+        mimeOverrides: { '.custom': 'application/x-custom' }
+      });
+      const resp = await net.fetch('foo://app/module.custom');
+      expect(resp.headers.get('x-custom')).to.equal('yes');
+      expect(resp.headers.get('content-type')).to.equal('application/x-custom');
+    });
+
+    it('answers conditional requests', async () => {
+      protocol.registerDirectoryHandler('foo', rootDir);
+      const resp = await net.fetch('foo://app/file.txt');
+      const etag = resp.headers.get('etag')!;
+      expect(etag).to.be.a('string');
+      expect(resp.headers.get('last-modified')).to.be.a('string');
+
+      const notModified = await net.fetch('foo://app/file.txt', { headers: { 'if-none-match': etag } });
+      expect(notModified.status).to.equal(304);
+
+      const modified = await net.fetch('foo://app/file.txt', { headers: { 'if-none-match': '"other"' } });
+      expect(modified.status).to.equal(200);
+    });
+
+    it('answers range requests', async () => {
+      protocol.registerDirectoryHandler('foo', rootDir);
+      const resp = await net.fetch('foo://app/file.txt', { headers: { range: 'bytes=6-10' } });
+      expect(resp.status).to.equal(206);
+      expect(resp.headers.get('content-range')).to.equal('bytes 6-10/11');
+      expect(await resp.text()).to.equal('world');
+    });
+
+    it('serves files from asar archives', async () => {
+      protocol.registerDirectoryHandler('foo', path.join(fixturesPath, 'test.asar', 'a.asar'));
+      const resp = await net.fetch('foo://app/file1');
+      expect(await resp.text()).to.equal(fs.readFileSync(path.join(fixturesPath, 'test.asar', 'a.asar', 'file1'), 'utf8'));
+    });
+
+    it('throws when the scheme is already handled', () => {
+      protocol.registerDirectoryHandler('foo', rootDir);
+      expect(() => protocol.registerDirectoryHandler('foo', rootDir)).to.throw(/has been registered/);
+      expect(() => protocol.handle('foo', () => new Response(''))).to.throw(/Failed to register protocol/);
+    });
+
+    it('throws for relative paths', () => {
+      expect(() => protocol.registerDirectoryHandler('foo', 'relative/path')).to.throw(/absolute path/);
+    });
+  });
+
   describe('handle', () => {
     afterEach(closeAllWindows);
 
@@ -1779,5 +1896,143 @@ describe('protocol module', () => {
       })();
       expect(interceptedTime).to.be.lessThan(rawTime * 1.6);
     });
+
+    it('streams large bodies', async () => {
+      const chunk = Buffer.alloc(1024 * 1024, 'a');
+      const chunkCount = 64;
+      protocol.handle('test-scheme', () => new Response(new ReadableStream({
+        start (controller) {
+          for (let i = 0; i < chunkCount; i++) controller.enqueue(chunk);
+          controller.close();
+        }
+      })));
+      defer(() => { protocol.unhandle('test-scheme'); });
+      const body = await (await net.fetch('test-scheme://foo')).arrayBuffer();
+      expect(body.byteLength).to.equal(chunk.length * chunkCount);
+    });
+
+    it('reads byte streams with the configured read size', async () => {
+      const data = Buffer.alloc(3 * 1024 * 1024 + 17, 'b');
+      let offset = 0;
+      const requestedSizes = new Set<number>();
+      protocol.handle('test-scheme', () => new Response(new ReadableStream({
+        type: 'bytes',
+        pull (controller) {
+          const request = controller.byobRequest!;
+          const view = request.view as Uint8Array;
+          requestedSizes.add(view.byteLength);
+          const length = Math.min(view.byteLength, data.length - offset);
+          view.set(data.subarray(offset, offset + length));
+          offset += length;
+          request.respond(length);
+          if (offset === data.length) controller.close();
+        }
+      })), { readSize: 1024 * 1024 });
+      defer(() => { protocol.unhandle('test-scheme'); });
+      const body = Buffer.from(await (await net.fetch('test-scheme://foo')).arrayBuffer());
+      expect(body.equals(data)).to.be.true();
+      expect([...requestedSizes]).to.deep.equal([1024 * 1024]);
+    });
+
+    it('keeps byte stream chunks intact when the body is drained slowly', async () => {
+      const data = crypto.randomBytes(10 * 1000);
+      let offset = 0;
+      protocol.handle('test-scheme', () => new Response(new ReadableStream({
+        type: 'bytes',
+        pull (controller) {
+          const request = controller.byobRequest!;
+          const view = request.view as Uint8Array;
+          const length = Math.min(1000, data.length - offset);
+          view.set(data.subarray(offset, offset + length));
+          offset += length;
+          request.respond(length);
+          if (offset === data.length) controller.close();
+        }
+      })), { readSize: 4000 });
+      defer(() => { protocol.unhandle('test-scheme'); });
+      const reader = (await net.fetch('test-scheme://foo')).body!.getReader();
+      const chunks: Buffer[] = [];
+      while (true) {
+        // Let the handler's stream run ahead of the consumer.
+        await setTimeout(20);
+        const { done, value } = await reader.read();
+        if (done) break;
+        chunks.push(Buffer.from(value));
+      }
+      expect(Buffer.concat(chunks).equals(data)).to.be.true();
+    });
+
+    describe('with a response cache', () => {
+      afterEach(() => {
+        try { protocol.unhandle('test-scheme'); } catch { /* ignore */ }
+      });
+
+      it('serves fresh responses without calling the handler', async () => {
+        let calls = 0;
+        protocol.handle('test-scheme', () => {
+          calls++;
+          return new Response('hello', { headers: { 'cache-control': 'max-age=60' } });
+        }, { cache: {} });
+        for (let i = 0; i < 3; i++) {
+          const resp = await net.fetch('test-scheme://foo');
+          expect(await resp.text()).to.equal('hello');
+        }
+        expect(calls).to.equal(1);
+        expect(protocol.getResponseCacheStats('test-scheme')).to.deep.include({ hits: 2, misses: 1, entryCount: 1, size: 5 });
+      });
+
+      it('does not cache responses marked no-store', async () => {
+        let calls = 0;
+        protocol.handle('test-scheme', () => {
+          calls++;
+          return new Response('hello', { headers: { 'cache-control': 'no-store' } });
+        }, { cache: { defaultMaxAge: 60 } });
+        await (await net.fetch('test-scheme://foo')).text();
+        await (await net.fetch('test-scheme://foo')).text();
+        expect(calls).to.equal(2);
+      });
+
+      it('revalidates stale responses with If-None-Match', async () => {
+        const conditions: (string | null)[] = [];
+        protocol.handle('test-scheme', (req) => {
+          const condition = req.headers.get('if-none-match');
+          conditions.push(condition);
+          if (condition === '"v1"') return new Response(null, { status: 304 });
+          return new Response('hello', { headers: { 'cache-control': 'no-cache', etag: '"v1"' } });
+        }, { cache: {} });
+        expect(await (await net.fetch('test-scheme://foo')).text()).to.equal('hello');
+        const resp = await net.fetch('test-scheme://foo');
+        expect(resp.status).to.equal(200);
+        expect(await resp.text()).to.equal('hello');
+        expect(conditions).to.deep.equal([null, '"v1"']);
+      });
+
+      it('can be cleared', async () => {
+        let calls = 0;
+        protocol.handle('test-scheme', () => {
+          calls++;
+          return new Response('hello', { headers: { 'cache-control': 'max-age=60' } });
+        }, { cache: {} });
+        await (await net.fetch('test-scheme://foo')).text();
+        protocol.clearResponseCache('test-scheme', 'test-scheme://foo');
+        await (await net.fetch('test-scheme://foo')).text();
+        expect(calls).to.equal(2);
+        expect(protocol.getResponseCacheStats('test-scheme')!.entryCount).to.equal(1);
+      });
+
+      it('returns null stats for schemes without a cache', () => {
+        protocol.handle('test-scheme', () => new Response('hello'));
+        expect(protocol.getResponseCacheStats('test-scheme')).to.be.null();
+      });
+
+      it('throws when caching a built-in scheme', () => {
+        expect(() => protocol.handle('https', () => new Response(''), { cache: {} })).to.throw(/not supported/);
+      });
+
+      it('throws for a relative disk path', () => {
+        expect(() => protocol.handle('test-scheme', () => new Response(''), { cache: { diskPath: 'cache' } })).to.throw(/absolute path/);
+        expect(protocol.isProtocolHandled('test-scheme')).to.be.false();
+      });
+    });
   });
 });
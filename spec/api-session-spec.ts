@@ -12,7 +12,7 @@ import * as https from 'node:https';
 import * as path from 'node:path';
 import { setTimeout } from 'node:timers/promises';
 
-import { defer, ifit, listen } from './lib/spec-helpers';
+import { defer, ifit, listen, waitUntil } from './lib/spec-helpers';
 import { closeAllWindows } from './lib/window-helpers';
 
 describe('session module', () => {
@@ -755,6 +755,142 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.resolveProxy(url)', () => {
+    it('resolves many URLs concurrently and reuses results', async () => {
+      const customSession = session.fromPartition(`resolveproxy-${Math.random()}`);
+      await customSession.setProxy({ proxyRules: 'http=myproxy:80' });
+      const urls = Array.from({ length: 50 }, (_, i) => `http://host${i}.example.com/`);
+      const proxies = await Promise.all(urls.map(url => customSession.resolveProxy(url)));
+      expect(proxies).to.deep.equal(urls.map(() => 'PROXY myproxy:80'));
+      // The same URLs are served from the cache.
+      await Promise.all(urls.map(url => customSession.resolveProxy(url)));
+      const stats = customSession.getResolveProxyStats();
+      expect(stats.lookups).to.equal(urls.length);
+      expect(stats.cacheHits).to.equal(urls.length);
+      expect(stats.queueDepth).to.equal(0);
+      expect(stats.activeLookups).to.equal(0);
+      expect(stats.maxLatency).to.be.at.least(stats.averageLatency);
+    });
+
+    it('does not reuse results after the proxy configuration changes', async () => {
+      const customSession = session.fromPartition(`resolveproxy-${Math.random()}`);
+      await customSession.setProxy({ proxyRules: 'http=myproxy:80' });
+      expect(await customSession.resolveProxy('http://example.com/')).to.equal('PROXY myproxy:80');
+      await customSession.setProxy({ mode: 'direct' });
+      expect(await customSession.resolveProxy('http://example.com/')).to.equal('DIRECT');
+    });
+
+    it('does not reuse results for other paths of http URLs', async () => {
+      const server = http.createServer((req, res) => {
+        res.writeHead(200, { 'Content-Type': 'application/x-ns-proxy-autoconfig' });
+        res.end(`
+          function FindProxyForURL(url, host) {
+            return url.indexOf('/proxied') !== -1 ? "PROXY myproxy:80" : "DIRECT";
+          }
+        `);
+      });
+      defer(() => server.close());
+      const { url } = await listen(server);
+      const customSession = session.fromPartition(`resolveproxy-${Math.random()}`);
+      await customSession.setProxy({ pacScript: url });
+      expect(await customSession.resolveProxy('http://example.com/direct')).to.equal('DIRECT');
+      expect(await customSession.resolveProxy('http://example.com/proxied')).to.equal('PROXY myproxy:80');
+    });
+  });
+
+  describe('ses.prefetchDNS(hosts)', () => {
+    it('resolves each host once and reports per-host results', async () => {
+      const customSession = session.fromPartition('resolvehost');
+      const hosts = ['ipv4.localhost2', 'ipv6.localhost2', 'ipv4.localhost2', 'notfound.localhost2'];
+      const results = await customSession.prefetchDNS(hosts, { priority: 'highest' });
+      expect(results.map(result => result.host)).to.deep.equal(hosts);
+      for (const result of results) expect(result.duration).to.be.a('number');
+      expect(results[0].error).to.be.undefined();
+      expect(results[1].error).to.be.undefined();
+      expect(results[2]).to.deep.equal(results[0]);
+      expect(results[3].error).to.equal('net::ERR_NAME_NOT_RESOLVED');
+    });
+
+    it('resolves an empty list', async () => {
+      expect(await session.defaultSession.prefetchDNS([])).to.deep.equal([]);
+    });
+
+    it('rejects empty hosts', async () => {
+      await expect(session.defaultSession.prefetchDNS([''])).to.eventually.be.rejectedWith(/non-empty hosts/);
+    });
+
+    it('throws for an unknown priority', () => {
+      expect(() => session.defaultSession.prefetchDNS(['localhost'], { priority: 'urgent' as any })).to.throw(TypeError, /Invalid priority 'urgent'/);
+    });
+  });
+
+  describe('ses.preconnectMany(options)', () => {
+    it('connects to each origin', async () => {
+      const connections = [0, 0];
+      const servers = connections.map((_, i) => {
+        const server = http.createServer((req, res) => res.end());
+        server.on('connection', () => { connections[i]++; });
+        return server;
+      });
+      defer(() => servers.forEach(server => server.close()));
+      const urls = await Promise.all(servers.map(async server => (await listen(server)).url));
+      const customSession = session.fromPartition(`preconnect-${Math.random()}`);
+      customSession.preconnectMany([{ url: urls[0], numSockets: 2 }, { url: urls[1], numSockets: 3 }]);
+      await waitUntil(() => connections[0] === 2 && connections[1] === 3);
+    });
+
+    it('validates each origin', () => {
+      expect(() => {
+        session.defaultSession.preconnectMany([{ url: 'https://example.com' }, { url: '' }]);
+      }).to.throw(/Must pass non-empty valid url to session.preconnectMany/);
+      expect(() => {
+        session.defaultSession.preconnectMany([{ url: 'https://example.com', numSockets: 7 }]);
+      }).to.throw(/numSocketsToPreconnect is outside range/);
+    });
+  });
+
+  describe('ses.setRendererProcessPool(options)', () => {
+    afterEach(closeAllWindows);
+
+    const rendererPids = () => new Set(app.getAppMetrics().filter(metric => metric.type === 'Tab').map(metric => metric.pid));
+
+    it('hands a launched process to a new window', async () => {
+      const customSession = session.fromPartition(`renderer-pool-${Math.random()}`);
+      defer(() => customSession.setRendererProcessPool({ size: 0 }));
+      const existingPids = rendererPids();
+      customSession.setRendererProcessPool({ size: 1, webPreferences: { sandbox: true } });
+      // The pool counts a process as available before it has launched, so
+      // wait for its PID to show up.
+      let pooledPid: number | undefined;
+      await waitUntil(() => {
+        pooledPid = [...rendererPids()].find(pid => !existingPids.has(pid));
+        return pooledPid !== undefined;
+      });
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: customSession, sandbox: true } });
+      await w.loadURL('about:blank');
+      expect(w.webContents.getOSProcessId()).to.equal(pooledPid);
+      expect(customSession.getRendererProcessPoolStats()).to.include({ size: 1, hits: 1, misses: 0 });
+      await waitUntil(() => customSession.getRendererProcessPoolStats().available === 1);
+    });
+
+    it('launches a new process when preferences do not match', async () => {
+      const customSession = session.fromPartition(`renderer-pool-${Math.random()}`);
+      defer(() => customSession.setRendererProcessPool({ size: 0 }));
+      customSession.setRendererProcessPool({ size: 1, webPreferences: { sandbox: true } });
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: customSession, sandbox: false } });
+      await w.loadURL('about:blank');
+      expect(customSession.getRendererProcessPoolStats()).to.include({ hits: 0, misses: 1, available: 1 });
+    });
+
+    it('validates the size', () => {
+      expect(() => {
+        session.defaultSession.setRendererProcessPool({ size: 9 });
+      }).to.throw(/Must pass a size between 0 and 8/);
+    });
+  });
+
   describe('ses.resolveHost(host)', () => {
     let customSession: Electron.Session;
 
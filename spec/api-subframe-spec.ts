@@ -117,6 +117,19 @@ describe('renderer nodeIntegrationInSubFrames', () => {
         expect(frameId).to.equal(event3[0].frameId);
       });
 
+      it('should run process.nextTick callbacks in every frame', async () => {
+        const detailsPromise = emittedNTimes(ipcMain, 'preload-ran', 3);
+        w.loadFile(path.resolve(__dirname, `fixtures/sub-frames/frame-with-frame-container${fixtureSuffix}.html`));
+        const details = await detailsPromise;
+        const ranPromise = emittedNTimes(ipcMain, 'preload-next-tick-ran', 3);
+        for (const [event] of details) {
+          event.senderFrame.send('preload-next-tick');
+        }
+        const ran = await ranPromise;
+        const frameIds = ran.map(([, frameId]) => frameId);
+        expect(frameIds).to.have.members(details.map(([event]) => event.frameId));
+      });
+
       it('should not expose globals in main world', async () => {
         const detailsPromise = emittedNTimes(ipcMain, 'preload-ran', 2);
         w.loadFile(path.resolve(__dirname, `fixtures/sub-frames/frame-container${fixtureSuffix}.html`));
@@ -183,6 +196,98 @@ describe('renderer nodeIntegrationInSubFrames', () => {
     generateTests(config.title, config.webPreferences);
   }
 
+  generateTests('with shared environment on', {
+    preload: path.resolve(__dirname, 'fixtures/sub-frames/preload.js'),
+    nodeIntegrationInSubFrames: true,
+    nodeIntegrationSharedEnvironment: true
+  });
+
+  describe('nodeIntegrationSharedEnvironment', () => {
+    let w: BrowserWindow;
+
+    afterEach(async () => {
+      await closeWindow(w);
+      w = null as unknown as BrowserWindow;
+    });
+
+    const loadFrames = async (webPreferences: Electron.WebPreferences) => {
+      w = new BrowserWindow({
+        show: false,
+        webPreferences: {
+          preload: path.resolve(__dirname, 'fixtures/sub-frames/shared-environment-preload.js'),
+          nodeIntegrationInSubFrames: true,
+          ...webPreferences
+        }
+      });
+      const detailsPromise = emittedNTimes(ipcMain, 'shared-preload-ran', 3);
+      w.loadFile(path.resolve(__dirname, 'fixtures/sub-frames/frame-with-frame-container.html'));
+      return (await detailsPromise).map(([event, details]) => ({ frameId: event.frameId, ...details }));
+    };
+
+    it('shares the module cache between same-origin frames', async () => {
+      const details = await loadFrames({ nodeIntegrationSharedEnvironment: true });
+      expect(details.map(d => d.count)).to.deep.equal([1, 2, 3]);
+      expect(details.map(d => d.isMainFrame)).to.deep.equal([true, false, false]);
+      expect(new Set(details.map(d => d.frameId)).size).to.equal(3);
+      expect(new Set(details.map(d => d.contextId)).size).to.equal(3);
+    });
+
+    it('gives each frame its own environment by default', async () => {
+      const details = await loadFrames({});
+      expect(details.map(d => d.count)).to.deep.equal([1, 1, 1]);
+    });
+
+    it('emits process events in each frame', async () => {
+      const documentEnd = emittedNTimes(ipcMain, 'shared-preload-document-end', 3);
+      const details = await loadFrames({ nodeIntegrationSharedEnvironment: true });
+      const frameIds = (await documentEnd).map(([, frameId]) => frameId);
+      expect(frameIds).to.have.members(details.map(d => d.frameId));
+    });
+
+    it('reports frame creation time and renderer memory', async function () {
+      this.timeout(120000);
+      // Adds 1, 10 and 50 same-origin iframes to a page with and without the
+      // shared environment, and reports how long their preload scripts took
+      // to run and the renderer's working set afterwards.
+      const results: Record<string, { ms: number, workingSetSize: number }> = {};
+      for (const nodeIntegrationSharedEnvironment of [false, true]) {
+        for (const count of [1, 10, 50]) {
+          await closeWindow(w);
+          const mainFrameRan = once(ipcMain, 'shared-preload-ran');
+          w = new BrowserWindow({
+            show: false,
+            webPreferences: {
+              preload: path.resolve(__dirname, 'fixtures/sub-frames/shared-environment-preload.js'),
+              nodeIntegrationInSubFrames: true,
+              nodeIntegrationSharedEnvironment
+            }
+          });
+          await w.loadFile(path.resolve(__dirname, 'fixtures/sub-frames/frame.html'));
+          await mainFrameRan;
+
+          const framesRan = emittedNTimes(ipcMain, 'shared-preload-ran', count);
+          const start = Date.now();
+          w.webContents.executeJavaScript(`for (let i = 0; i < ${count}; i++) {
+            const frame = document.createElement('iframe');
+            frame.src = './frame.html';
+            document.body.appendChild(frame);
+          }`);
+          await framesRan;
+          const ms = Date.now() - start;
+
+          const pid = w.webContents.getOSProcessId();
+          const metrics = app.getAppMetrics().find(metric => metric.pid === pid);
+          expect(metrics).to.not.be.undefined();
+          results[`${count} frames${nodeIntegrationSharedEnvironment ? ', shared' : ''}`] = {
+            ms,
+            workingSetSize: metrics!.memory.workingSetSize
+          };
+        }
+      }
+      console.table(results);
+    });
+  });
+
   describe('internal <iframe> inside of <webview>', () => {
     let w: BrowserWindow;
 
@@ -781,4 +781,107 @@ describe('utilityProcess module', () => {
       await fs.rm(tmpDir, { recursive: true });
     });
   });
+
+  describe('utilityProcess.createPool()', () => {
+    const modulePath = path.join(fixturesPath, 'pool-worker.js');
+    let pool: Electron.UtilityProcessPool | null = null;
+
+    afterEach(() => {
+      pool?.close();
+      pool = null;
+    });
+
+    const runJob = async (worker: Electron.UtilityProcess) => {
+      worker.postMessage('job');
+      const [result] = await once(worker, 'message');
+      return result;
+    };
+
+    it('throws when the options are not valid', () => {
+      expect(() => utilityProcess.createPool({ modulePath: '' })).to.throw(/Missing UtilityProcess entry script/);
+      expect(() => utilityProcess.createPool({ modulePath, size: 0 })).to.throw(/size must be a positive integer/);
+      expect(() => utilityProcess.createPool({ modulePath, maxJobsPerWorker: 1.5 })).to.throw(/maxJobsPerWorker must be a positive integer/);
+      expect(() => utilityProcess.createPool({ modulePath, preload: [1 as any] })).to.throw(/preload must be an array of strings/);
+    });
+
+    it('hands out workers that loaded the preload modules', async () => {
+      pool = utilityProcess.createPool({ modulePath, preload: ['./pool-preload.js'] });
+      const worker = await pool.acquire();
+      const result = await runJob(worker);
+      expect(result.preloaded).to.be.true();
+      pool.release(worker);
+    });
+
+    it('keeps the workers launched ahead of use', async () => {
+      pool = utilityProcess.createPool({ modulePath, size: 2 });
+      while (pool.getStats().idle < 2) {
+        await setImmediate();
+      }
+      expect(pool.getStats()).to.include({ size: 2, starting: 0, idle: 2, busy: 0, queued: 0 });
+    });
+
+    it('queues jobs until a worker is released', async () => {
+      pool = utilityProcess.createPool({ modulePath });
+      const first = await pool.acquire();
+      const pending = pool.acquire();
+      expect(pool.getStats()).to.include({ busy: 1, queued: 1 });
+
+      pool.release(first);
+      const second = await pending;
+      expect(second).to.equal(first);
+      expect(pool.getStats()).to.include({ busy: 1, queued: 0, completedJobs: 1 });
+      expect(pool.getStats().averageWaitTime).to.be.a('number');
+    });
+
+    it('replaces workers after maxJobsPerWorker jobs', async () => {
+      pool = utilityProcess.createPool({ modulePath, maxJobsPerWorker: 1 });
+      const first = await pool.acquire();
+      const { pid } = await runJob(first);
+      pool.release(first);
+
+      const second = await pool.acquire();
+      expect(second).to.not.equal(first);
+      expect((await runJob(second)).pid).to.not.equal(pid);
+      expect(pool.getStats()).to.include({ recycled: 1, crashed: 0 });
+    });
+
+    it('respawns workers that exit', async () => {
+      pool = utilityProcess.createPool({ modulePath });
+      const first = await pool.acquire();
+      first.kill();
+      await once(first, 'exit');
+
+      const second = await pool.acquire();
+      expect(second).to.not.equal(first);
+      expect(await runJob(second)).to.have.property('pid').that.is.a('number');
+      expect(pool.getStats()).to.include({ crashed: 1 });
+    });
+
+    it('keeps respawning workers that exit after they are ready', async () => {
+      pool = utilityProcess.createPool({ modulePath });
+      for (let i = 0; i < 4; i++) {
+        const worker = await pool.acquire();
+        worker.postMessage('exit');
+        await once(worker, 'exit');
+      }
+      expect(pool.getStats()).to.include({ crashed: 4 });
+    });
+
+    it('stops respawning workers that cannot start', async () => {
+      pool = utilityProcess.createPool({ modulePath: path.join(fixturesPath, 'does-not-exist.js') });
+      while (pool.getStats().crashed < 3) {
+        await setImmediate();
+      }
+      expect(pool.getStats()).to.include({ crashed: 3, starting: 0, idle: 0, busy: 0 });
+    });
+
+    it('rejects pending jobs when closed', async () => {
+      pool = utilityProcess.createPool({ modulePath });
+      await pool.acquire();
+      const pending = pool.acquire();
+      pool.close();
+      await expect(pending).to.eventually.be.rejectedWith(/closed/);
+      await expect(pool.acquire()).to.eventually.be.rejectedWith(/closed/);
+    });
+  });
 });
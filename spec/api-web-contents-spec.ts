@@ -1,3 +1,4 @@
+import { nativeImage } from 'electron/common';
 import { BrowserWindow, ipcMain, webContents, session, app, BrowserView, WebContents, BaseWindow, WebContentsView } from 'electron/main';
 
 import { expect } from 'chai';
@@ -2401,6 +2402,59 @@ describe('webContents module', () => {
     });
   });
 
+  describe('capturePageToBuffer()', () => {
+    afterEach(closeAllWindows);
+
+    it('resolves with an encoded PNG scaled to fit maxSize', async () => {
+      const w = new BrowserWindow({ show: false, width: 400, height: 300 });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'a.html'));
+      w.show();
+      const buffer = await w.webContents.capturePageToBuffer(undefined, {
+        format: 'png',
+        maxSize: { width: 100, height: 100 }
+      }) as Buffer;
+      expect(buffer.subarray(1, 4).toString()).to.equal('PNG');
+      const image = nativeImage.createFromBuffer(buffer);
+      expect(image.getSize().width).to.be.at.most(100);
+      expect(image.getSize().height).to.be.at.most(100);
+    });
+
+    it('resolves with raw pixels for the bgra format', async () => {
+      const w = new BrowserWindow({ show: false, width: 400, height: 300 });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'a.html'));
+      w.show();
+      const image = await w.webContents.capturePage(undefined, { scale: 0.5 });
+      const bitmap = await w.webContents.capturePageToBuffer(undefined, { format: 'bgra', scale: 0.5 }) as Electron.CapturedBitmap;
+      expect({ width: bitmap.width, height: bitmap.height }).to.deep.equal(image.getSize());
+      expect(bitmap.data.length).to.equal(bitmap.width * bitmap.height * 4);
+    });
+
+    it('throws for an unknown format', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => {
+        w.webContents.capturePageToBuffer(undefined, { format: 'gif' as any });
+      }).to.throw('Invalid capture format: gif');
+    });
+  });
+
+  describe('webContents.capturePages()', () => {
+    afterEach(closeAllWindows);
+
+    it('captures every page in order', async () => {
+      const windows = Array.from({ length: 3 }, (_, i) => new BrowserWindow({ show: false, width: 100 + i * 10, height: 100 }));
+      await Promise.all(windows.map(w => w.loadFile(path.join(fixturesPath, 'pages', 'a.html'))));
+      const images = await webContents.capturePages(windows.map(w => w.webContents), { concurrency: 2 });
+      expect(images).to.have.lengthOf(3);
+      for (const image of images) {
+        expect(image.constructor.name).to.equal('NativeImage');
+      }
+    });
+
+    it('rejects an invalid concurrency', async () => {
+      await expect(webContents.capturePages([], { concurrency: 0 })).to.eventually.be.rejectedWith(RangeError);
+    });
+  });
+
   describe('setBackgroundThrottling()', () => {
     afterEach(closeAllWindows);
     it('does not crash when allowing', () => {
@@ -2590,6 +2644,33 @@ describe('webContents module', () => {
       expect(data).to.be.an.instanceof(Buffer).that.is.not.empty();
     });
 
+    it('can write a PDF to a file', async () => {
+      await w.loadURL('data:text/html,<h1>Hello, World!</h1>');
+
+      const tmpDir = await fs.promises.mkdtemp(path.resolve(os.tmpdir(), 'e-spec-printtopdffile-'));
+      defer(() => fs.promises.rm(tmpDir, { force: true, recursive: true }));
+      const pdfPath = path.join(tmpDir, 'test.pdf');
+
+      await w.webContents.printToPDFFile(pdfPath, { landscape: true });
+      const data = await fs.promises.readFile(pdfPath);
+      expect(data.subarray(0, 5).toString()).to.equal('%PDF-');
+
+      const pdfInfo = await readPDF(data);
+      expect(pdfInfo.numPages).to.equal(1);
+    });
+
+    it('rejects relative paths', async () => {
+      await w.loadURL('data:text/html,<h1>Hello, World!</h1>');
+      await expect(w.webContents.printToPDFFile('test.pdf')).to.eventually.be.rejectedWith(/filePath must be an absolute path/);
+    });
+
+    it('rejects when the PDF file cannot be written', async () => {
+      await w.loadURL('data:text/html,<h1>Hello, World!</h1>');
+
+      const pdfPath = path.join(os.tmpdir(), 'e-spec-does-not-exist', 'nested', 'test.pdf');
+      await expect(w.webContents.printToPDFFile(pdfPath)).to.eventually.be.rejectedWith(/Failed to write PDF/);
+    });
+
     type PageSizeString = Exclude<Required<Electron.PrintToPDFOptions>['pageSize'], Electron.Size>;
 
     it('with custom page sizes', async () => {
@@ -145,6 +145,26 @@ describe('webRequest module', () => {
       await expect(ajax(`${defaultURL}filter/test`)).to.eventually.be.rejected();
     });
 
+    it('can filter URLs among many patterns', async () => {
+      const urls = [defaultURL + 'filter/*', '*://*.example.org/*'];
+      const excludeUrls = [defaultURL + 'filter/exclude/*'];
+      for (let i = 0; i < 5000; i++) {
+        urls.push(`*://host${i}.example.com/*`, `${defaultURL}other${i}/*`);
+        excludeUrls.push(`*://*.host${i}.example.net/*`);
+      }
+      ses.webRequest.onBeforeRequest({ urls, excludeUrls }, cancel);
+      expect((await ajax(`${defaultURL}nofilter/test`)).data).to.equal('/nofilter/test');
+      expect((await ajax(`${defaultURL}filter/exclude/test`)).data).to.equal('/filter/exclude/test');
+      await expect(ajax(`${defaultURL}filter/test`)).to.eventually.be.rejected();
+      await expect(ajax(`${defaultURL}other4999/test`)).to.eventually.be.rejected();
+    });
+
+    it('matches a URL pattern path without its trailing slash', async () => {
+      ses.webRequest.onBeforeRequest({ urls: [defaultURL + 'filter/*'] }, cancel);
+      await expect(ajax(`${defaultURL}filter`)).to.eventually.be.rejected();
+      expect((await ajax(`${defaultURL}filtered`)).data).to.equal('/filtered');
+    });
+
     it('can filter URLs and types', async () => {
       const filter1: Electron.WebRequestFilter = { urls: [defaultURL + 'filter/*'], types: ['xhr'] };
       ses.webRequest.onBeforeRequest(filter1, cancel);
@@ -329,6 +349,125 @@ describe('webRequest module', () => {
     });
   });
 
+  describe('webRequest.setRules', () => {
+    afterEach(() => {
+      ses.webRequest.setRules([]);
+      ses.webRequest.onBeforeRequest(null);
+      ses.webRequest.onBeforeSendHeaders(null);
+      ses.webRequest.onHeadersReceived(null);
+    });
+
+    it('can block requests and counts hits', async () => {
+      ses.webRequest.setRules([
+        { id: 1, condition: { urls: [defaultURL + 'blocked/*'] }, action: { type: 'block' } },
+        { id: 2, condition: { urls: [defaultURL + 'other/*'] }, action: { type: 'block' } }
+      ]);
+      await expect(ajax(`${defaultURL}blocked/test`)).to.eventually.be.rejected();
+      await expect(ajax(`${defaultURL}blocked/test2`)).to.eventually.be.rejected();
+      expect((await ajax(`${defaultURL}allowed/test`)).data).to.equal('/allowed/test');
+      expect(ses.webRequest.getRuleHitCounts()).to.deep.equal([{ id: 1, hits: 2 }, { id: 2, hits: 0 }]);
+    });
+
+    it('does not call the onBeforeRequest listener for requests a rule applies to', async () => {
+      const urls: string[] = [];
+      ses.webRequest.onBeforeRequest((details, callback) => {
+        urls.push(details.url);
+        callback({});
+      });
+      ses.webRequest.setRules([
+        { id: 1, condition: { urls: [defaultURL + 'allowed/*'] }, action: { type: 'allow' } }
+      ]);
+      await ajax(`${defaultURL}allowed/test`);
+      await ajax(`${defaultURL}listener/test`);
+      expect(urls).to.deep.equal([`${defaultURL}listener/test`]);
+    });
+
+    it('prefers allow rules over block rules of the same priority', async () => {
+      ses.webRequest.setRules([
+        { id: 1, action: { type: 'block' } },
+        { id: 2, condition: { urls: [defaultURL + 'allowed/*'] }, action: { type: 'allow' } },
+        { id: 3, priority: 2, condition: { urls: [defaultURL + 'allowed/blocked'] }, action: { type: 'block' } }
+      ]);
+      expect((await ajax(`${defaultURL}allowed/test`)).data).to.equal('/allowed/test');
+      await expect(ajax(`${defaultURL}allowed/blocked`)).to.eventually.be.rejected();
+      await expect(ajax(`${defaultURL}other`)).to.eventually.be.rejected();
+    });
+
+    it('can redirect requests by prefix', async () => {
+      ses.webRequest.setRules([{
+        id: 1,
+        condition: { urls: [defaultURL + 'old/*'] },
+        action: { type: 'redirect', redirect: { fromPrefix: defaultURL + 'old/', toPrefix: defaultURL + 'new/' } }
+      }]);
+      const { data } = await ajax(`${defaultURL}old/test?query`);
+      expect(data).to.equal('/new/test?query');
+    });
+
+    it('can modify request and response headers', async () => {
+      ses.webRequest.setRules([{
+        id: 1,
+        condition: { urls: [defaultURL + '*'] },
+        action: {
+          type: 'modifyHeaders',
+          requestHeaders: [{ header: 'Accept', operation: 'set', value: '*/*;test/header' }],
+          responseHeaders: [
+            { header: 'Custom', operation: 'remove' },
+            { header: 'X-Rule', operation: 'set', value: 'applied' }
+          ]
+        }
+      }]);
+      const { data, headers } = await ajax(defaultURL);
+      expect(data).to.equal('/header/received');
+      expect(headers).to.not.have.property('custom');
+      expect(headers['x-rule']).to.equal('applied');
+      expect(ses.webRequest.getRuleHitCounts()).to.deep.equal([{ id: 1, hits: 2 }]);
+    });
+
+    it('calls the header listeners with the headers modified by rules', async () => {
+      ses.webRequest.setRules([{
+        id: 1,
+        condition: { urls: [defaultURL + '*'] },
+        action: {
+          type: 'modifyHeaders',
+          requestHeaders: [{ header: 'X-Request-Rule', operation: 'set', value: 'applied' }],
+          responseHeaders: [{ header: 'X-Response-Rule', operation: 'set', value: 'applied' }]
+        }
+      }]);
+      let requestHeaders: Record<string, string> | undefined;
+      let responseHeaders: Record<string, string[]> | undefined;
+      ses.webRequest.onBeforeSendHeaders((details, callback) => {
+        requestHeaders = details.requestHeaders;
+        callback({});
+      });
+      ses.webRequest.onHeadersReceived((details, callback) => {
+        responseHeaders = details.responseHeaders;
+        callback({});
+      });
+      const { headers } = await ajax(defaultURL);
+      expect(requestHeaders).to.have.property('X-Request-Rule', 'applied');
+      expect(responseHeaders).to.have.deep.property('X-Response-Rule', ['applied']);
+      expect(headers['x-response-rule']).to.equal('applied');
+    });
+
+    it('throws for invalid rules', () => {
+      expect(() => {
+        ses.webRequest.setRules([{ id: 1, action: { type: 'unknown' as any } }]);
+      }).to.throw(/Rule 1 has an unknown action type 'unknown'/);
+      expect(() => {
+        ses.webRequest.setRules([{
+          id: 1,
+          action: { type: 'modifyHeaders', requestHeaders: [{ header: 'X-Test', operation: 'unknown' as any }] }
+        }]);
+      }).to.throw(/Rule 1 has an unknown header operation 'unknown'/);
+      expect(() => {
+        ses.webRequest.setRules([{ id: 1, action: { type: 'block' } }, { id: 1, action: { type: 'block' } }]);
+      }).to.throw(/Duplicate rule id 1/);
+      expect(() => {
+        ses.webRequest.setRules([{ id: 1, action: { type: 'redirect' } }]);
+      }).to.throw(/Rule 1 must have a 'redirect'/);
+    });
+  });
+
   describe('webRequest.onBeforeSendHeaders', () => {
     afterEach(() => {
       ses.webRequest.onBeforeSendHeaders(null);
@@ -0,0 +1 @@
+globalThis.poolPreloaded = true;
@@ -0,0 +1,7 @@
+process.parentPort.on('message', ({ data }) => {
+  if (data === 'exit') process.exit(0);
+  process.parentPort.postMessage({
+    pid: process.pid,
+    preloaded: globalThis.poolPreloaded === true
+  });
+});
@@ -0,0 +1,8 @@
+const { app } = require('electron');
+
+const { greet } = require('./module.js');
+
+app.whenReady().then(() => {
+  console.log(greet());
+  app.quit();
+});
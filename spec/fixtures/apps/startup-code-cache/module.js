@@ -0,0 +1 @@
+exports.greet = () => 'hello';
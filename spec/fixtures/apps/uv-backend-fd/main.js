@@ -0,0 +1,62 @@
+const { app } = require('electron');
+
+const { once } = require('node:events');
+const { promises: fs } = require('node:fs');
+const net = require('node:net');
+const os = require('node:os');
+const path = require('node:path');
+const { performance } = require('node:perf_hooks');
+
+async function time (fn) {
+  const start = performance.now();
+  await fn();
+  return performance.now() - start;
+}
+
+// Exercises uv timers, sockets, fs requests and async handles, which are all
+// dispatched from the message pump with --enable-features=WatchUvBackendFd,
+// and prints how long each took in milliseconds.
+async function main () {
+  const timers = await time(async () => {
+    for (let i = 0; i < 1000; i++) {
+      await new Promise(resolve => setTimeout(resolve, 0));
+    }
+  });
+  await new Promise(resolve => setTimeout(resolve, 50));
+  await new Promise(resolve => setImmediate(resolve));
+
+  const server = net.createServer(socket => socket.pipe(socket));
+  await new Promise(resolve => server.listen(0, '127.0.0.1', resolve));
+  const socket = net.connect(server.address().port, '127.0.0.1');
+  await once(socket, 'connect');
+  const echo = await time(async () => {
+    for (let i = 0; i < 1000; i++) {
+      const message = `ping ${i}`;
+      socket.write(message);
+      const [data] = await once(socket, 'data');
+      if (data.toString() !== message) throw new Error(`Unexpected echo: ${data}`);
+    }
+  });
+  socket.destroy();
+  server.close();
+
+  const dir = await fs.mkdtemp(path.join(os.tmpdir(), 'uv-backend-fd-'));
+  const file = path.join(dir, 'file');
+  const contents = Buffer.alloc(1024 * 1024, 'a');
+  const files = await time(async () => {
+    for (let i = 0; i < 50; i++) {
+      await fs.writeFile(file, contents);
+      if (!(await fs.readFile(file)).equals(contents)) throw new Error('Read back different contents');
+    }
+  });
+  await fs.rm(dir, { recursive: true });
+
+  console.log(JSON.stringify({ timers, echo, files }));
+}
+
+app.whenReady().then(main).then(() => {
+  app.quit();
+}, (error) => {
+  console.error(error);
+  app.exit(1);
+});
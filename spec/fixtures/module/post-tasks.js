@@ -0,0 +1,15 @@
+const { postTasks } = process._linkedBinding('electron_common_testing');
+
+async function measure (count, delayMs) {
+  const ms = await postTasks(count, delayMs);
+  return Math.round(count / (ms / 1000));
+}
+
+(async () => {
+  const immediate = await measure(100000, 0);
+  const delayed = await measure(10000, 1);
+  console.log(JSON.stringify({ immediate, delayed }));
+})().catch((error) => {
+  console.error(error);
+  process.exit(1);
+});
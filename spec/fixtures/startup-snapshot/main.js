@@ -0,0 +1,6 @@
+// Only runs when the main function of the startup snapshot did not.
+
+const { app } = require('electron');
+
+console.log('not ok startup snapshot main function did not run.');
+app.exit(1);
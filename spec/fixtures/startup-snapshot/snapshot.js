@@ -0,0 +1,37 @@
+// Built into a startup snapshot by script/build-startup-snapshot.js, see
+// script/verify-mksnapshot.py.
+
+const { startupSnapshot } = require('node:v8');
+
+const state = {
+  values: [1, 2, 3].map(value => value * 2),
+  building: startupSnapshot.isBuildingSnapshot(),
+  serialized: false,
+  deserialized: false
+};
+
+startupSnapshot.addSerializeCallback((data) => {
+  data.serialized = true;
+}, state);
+
+startupSnapshot.addDeserializeCallback((data) => {
+  data.deserialized = true;
+}, state);
+
+startupSnapshot.setDeserializeMainFunction((data) => {
+  const { app } = require('electron');
+  const path = require('node:path');
+
+  app.whenReady().then(() => {
+    const ok = data.building && data.serialized && data.deserialized &&
+      !startupSnapshot.isBuildingSnapshot() &&
+      data.values.join() === '2,4,6' &&
+      path.basename(app.getAppPath()) === 'startup-snapshot';
+    if (ok) {
+      console.log('ok startup snapshot main function ran.');
+    } else {
+      console.log('not ok startup snapshot state was not restored.', data);
+    }
+    app.exit(ok ? 0 : 1);
+  });
+}, state);
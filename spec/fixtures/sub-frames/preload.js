@@ -8,6 +8,16 @@ ipcRenderer.on('preload-ping', () => {
   ipcRenderer.send('preload-pong', webFrame.routingId);
 });
 
+ipcRenderer.on('preload-next-tick', () => {
+  // Blink timers run outside of Node's callback scope, so the tick only
+  // runs once the uv loop has been activated.
+  setTimeout(() => {
+    process.nextTick(() => {
+      ipcRenderer.send('preload-next-tick-ran', webFrame.routingId);
+    });
+  });
+});
+
 window.addEventListener('unload', () => {
   ipcRenderer.send('preload-unload', window.location.href);
 });
@@ -0,0 +1,13 @@
+const { ipcRenderer, webFrame } = require('electron');
+
+const counter = require('./shared-environment-counter');
+
+ipcRenderer.send('shared-preload-ran', {
+  count: counter.increment(),
+  isMainFrame: process.isMainFrame,
+  contextId: process.contextId
+});
+
+process.once('document-end', () => {
+  ipcRenderer.send('shared-preload-document-end', webFrame.routingId);
+});
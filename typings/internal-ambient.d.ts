@@ -7,6 +7,9 @@ declare namespace NodeJS {
     _resolveFilename(request: string, parent?: NodeJS.Module | null, isMain?: boolean, options?: { paths: string[] }): string;
     _preloadModules(requests: string[]): void;
     _nodeModulePaths(from: string): string[];
+    createRequire(filename: string): NodeJS.Require;
+    enableCompileCache(directory?: string): { status: number, message?: string, directory?: string };
+    flushCompileCache(): void;
     _extensions: Record<string, (module: NodeJS.Module, filename: string) => any>;
     _cache: Record<string, NodeJS.Module>;
     wrapper: [string, string];
@@ -82,6 +85,7 @@ declare namespace NodeJS {
     realpath(path: string): string | false;
     copyFileOut(path: string): string | false;
     getFdAndValidateIntegrityLater(): number | -1;
+    getHeaderHash(): string | false;
   }
 
   interface AsarBinding {
@@ -179,6 +183,7 @@ declare namespace NodeJS {
     bypassCustomProtocolHandlers?: boolean;
     priority?: 'throttled' | 'idle' | 'lowest' | 'low' | 'medium' | 'highest';
     priorityIncremental?: boolean;
+    saveToFile?: { path: string; hash?: 'sha256'; resumeFrom?: number };
   };
   type ResponseHead = {
     statusCode: number;
@@ -202,6 +207,7 @@ declare namespace NodeJS {
     cancel(): void;
     on(eventName: 'data', listener: (event: any, data: ArrayBuffer, resume: () => void) => void): this;
     on(eventName: 'response-started', listener: (event: any, finalUrl: string, responseHead: ResponseHead) => void): this;
+    on(eventName: 'saved', listener: (event: any, details: Electron.SavedFileDetails) => void): this;
     on(eventName: 'complete', listener: (event: any) => void): this;
     on(eventName: 'error', listener: (event: any, netErrorString: string) => void): this;
     on(eventName: 'login', listener: (event: any, authInfo: Electron.AuthInfo, callback: (username?: string, password?: string) => void) => void): this;
@@ -231,6 +231,7 @@ declare namespace Electron {
   interface Protocol {
     registerProtocol(scheme: string, handler: any): boolean;
     interceptProtocol(scheme: string, handler: any): boolean;
+    _setResponseCache(scheme: string, options: NonNullable<Electron.HandleOptions['cache']>): void;
   }
 
   interface WebContents {
@@ -360,8 +361,29 @@ declare namespace ElectronInternal {
 
   interface PreloadScript extends Electron.PreloadScript {
     contents?: string;
+    codeCache?: Uint8Array;
+    // Identifies the source a code cache produced from |contents| belongs to.
+    // Unset when the frame cannot store code caches.
+    codeCacheVersion?: string;
     error?: Error;
   }
+
+  interface CompiledPreloadScript {
+    preload: Function;
+    // Set when a code cache was requested and none was given or it was
+    // rejected.
+    codeCache?: Uint8Array;
+  }
+
+  // Handed to frames that share the Node.js environment of an ancestor.
+  interface SharedEnvironment {
+    createRequire(filename: string): NodeJS.Require;
+    createProcess(): NodeJS.Process;
+    require?: NodeJS.Require;
+    Buffer: typeof Buffer;
+    setImmediate: typeof setImmediate;
+    clearImmediate: typeof clearImmediate;
+  }
 }
 
 declare namespace Chrome {